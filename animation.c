@@ -0,0 +1,167 @@
+#include "animation.h"
+#include <stdio.h>
+#include <string.h>
+
+// Runtime clip registry
+typedef struct AnimationRegistry {
+    AnimationClip clips[MAX_ANIMATION_CLIPS];
+    int clipCount;
+    char events[MAX_ANIMATION_EVENTS][CLIP_NAME_LENGTH];  // Event names by id
+    int eventCount;
+} AnimationRegistry;
+
+static AnimationRegistry animations;
+
+// Id of an event name, added on first use
+static int intern_event(const char *name) {
+    int id = FindAnimationEvent(name);
+    if (id >= 0 || animations.eventCount >= MAX_ANIMATION_EVENTS) return id;
+    strncpy(animations.events[animations.eventCount], name, CLIP_NAME_LENGTH - 1);
+    return animations.eventCount++;
+}
+
+// Trailing "frame:name" events of a clip line
+static void read_events(AnimationClip *clip, const char *text) {
+    char name[CLIP_NAME_LENGTH];
+    int frame, used;
+    while (sscanf(text, " %d:%31s%n", &frame, name, &used) == 2) {
+        text += used;
+        int id = intern_event(name);
+        if (id < 0 || clip->eventCount >= CLIP_MAX_EVENTS || frame < 0 || frame >= clip->frameCount) {
+            TraceLog(LOG_WARNING, "ANIMATION: Dropped event %s on clip %s", name, clip->name);
+            continue;
+        }
+        clip->events[clip->eventCount++] = (AnimationEvent){ frame, id };
+    }
+}
+
+/*
+    Read the clip file - one line per clip, '#' starts a comment:
+        name sprite first count seconds next [frame:event ...]
+    first / count pick frames of the atlas sprite, seconds is the time on each frame, next is the
+    clip that follows the last frame (the clip's own name loops it, '-' stops on the last frame)
+*/
+bool LoadAnimationClips(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        TraceLog(LOG_ERROR, "ANIMATION: Could not read %s", path);
+        return false;
+    }
+    memset(&animations, 0, sizeof(animations));
+
+    char line[512];
+    char nextNames[MAX_ANIMATION_CLIPS][CLIP_NAME_LENGTH];  // Resolved once every clip is known
+    while (fgets(line, sizeof(line), file)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        if (animations.clipCount >= MAX_ANIMATION_CLIPS) {
+            TraceLog(LOG_WARNING, "ANIMATION: More than %d clips in %s", MAX_ANIMATION_CLIPS, path);
+            break;
+        }
+
+        AnimationClip *clip = &animations.clips[animations.clipCount];
+        char sprite[SPRITE_NAME_LENGTH];
+        int used;
+        memset(clip, 0, sizeof(*clip));
+        if (sscanf(line, "%31s %31s %d %d %f %31s%n", clip->name, sprite, &clip->firstFrame, &clip->frameCount,
+                   &clip->frameTime, nextNames[animations.clipCount], &used) != 6) continue;
+
+        // Frames have to exist in the sprite and take time (a missing sprite leaves the clip empty)
+        clip->sheet = FindSprite(sprite);
+        clip->sprite = GetSpriteById(clip->sheet);
+        if (clip->frameCount <= 0 || clip->frameTime <= 0.0f || clip->firstFrame < 0 ||
+            clip->firstFrame + clip->frameCount > clip->sprite.frameCount) {
+            TraceLog(LOG_WARNING, "ANIMATION: Clip %s has no frames or is outside sprite %s", clip->name, sprite);
+            clip->firstFrame = 0;
+            clip->frameCount = 0;
+        }
+        read_events(clip, line + used);
+        animations.clipCount++;
+    }
+    fclose(file);
+
+    for (int i = 0; i < animations.clipCount; i++) {
+        animations.clips[i].next = strcmp(nextNames[i], "-") == 0 ? -1 : FindAnimationClip(nextNames[i]);
+    }
+    TraceLog(LOG_INFO, "ANIMATION: %d clips loaded from %s", animations.clipCount, path);
+    return true;
+}
+
+void UnloadAnimationClips(void) {
+    memset(&animations, 0, sizeof(animations));
+}
+
+int FindAnimationClip(const char *name) {
+    for (int i = 0; i < animations.clipCount; i++) {
+        if (strcmp(animations.clips[i].name, name) == 0) return i;
+    }
+    TraceLog(LOG_WARNING, "ANIMATION: No clip named %s", name);
+    return -1;
+}
+
+int FindAnimationEvent(const char *name) {
+    for (int i = 0; i < animations.eventCount; i++) {
+        if (strcmp(animations.events[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+const AnimationClip *GetAnimationClip(int clip) {
+    return clip >= 0 && clip < animations.clipCount ? &animations.clips[clip] : NULL;
+}
+
+Animator StartAnimation(int clip) {
+    return (Animator){ clip, 0, 0.0f };
+}
+
+// The time on the current frame carries over, so switching back and forth doesn't stall the frames
+void PlayAnimation(Animator *animator, int clip) {
+    if (animator->clip == clip) return;
+    animator->clip = clip;
+    animator->frame = 0;
+}
+
+// Bits of the events on the frame just entered
+static unsigned int frame_events(const AnimationClip *clip, int frame) {
+    unsigned int fired = 0;
+    for (int i = 0; i < clip->eventCount; i++) {
+        if (clip->events[i].frame == frame) fired |= 1u << clip->events[i].id;
+    }
+    return fired;
+}
+
+// At most one frame per call - the time left over when a frame changes is dropped
+unsigned int AdvanceAnimation(Animator *animator, float delta) {
+    const AnimationClip *clip = GetAnimationClip(animator->clip);
+    if (!clip || animator->frame >= clip->frameCount) return 0;
+
+    animator->time += delta;
+    if (animator->time < clip->frameTime) return 0;
+    animator->time = 0.0f;
+    animator->frame++;
+
+    // Past the last frame: loop, go on to the next clip, or stop
+    if (animator->frame >= clip->frameCount) {
+        if (clip->next < 0) return 0;
+        animator->clip = clip->next;
+        animator->frame = 0;
+        clip = GetAnimationClip(clip->next);
+    }
+    return frame_events(clip, animator->frame);
+}
+
+bool IsAnimationFinished(const Animator *animator) {
+    const AnimationClip *clip = GetAnimationClip(animator->clip);
+    return !clip || animator->frame >= clip->frameCount;
+}
+
+bool IsAnimationOneShot(const Animator *animator) {
+    const AnimationClip *clip = GetAnimationClip(animator->clip);
+    return clip && clip->next != animator->clip && animator->frame < clip->frameCount;
+}
+
+int GetAnimationSpriteFrame(const Animator *animator) {
+    const AnimationClip *clip = GetAnimationClip(animator->clip);
+    if (!clip || clip->frameCount == 0) return -1;
+    int frame = animator->frame < clip->frameCount ? animator->frame : clip->frameCount - 1;
+    return clip->firstFrame + frame;
+}
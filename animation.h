@@ -0,0 +1,60 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+// Include necessary libraries
+#include "atlas.h"   // Clips are cut from atlas sprites
+
+// Animation constants
+#define ANIMATION_CLIPS_PATH "animations.manifest"  // Clip definitions, loaded once with the atlas
+#define MAX_ANIMATION_CLIPS 64      // Clips in the registry
+#define MAX_ANIMATION_EVENTS 32     // Distinct event names (one bit each in AdvanceAnimation's result)
+#define CLIP_NAME_LENGTH 32         // Maximum clip / event name length
+#define CLIP_MAX_EVENTS 4           // Events on one clip
+
+// Event fired when a clip enters a frame
+typedef struct AnimationEvent {
+    int frame;                      // Frame within the clip
+    int id;                         // Event id (bit in AdvanceAnimation's result)
+} AnimationEvent;
+
+/*
+    Animation clip - a run of frames from one atlas sprite and how it plays
+    Clips are defined in ANIMATION_CLIPS_PATH and shared by every actor playing them, so an
+    actor only keeps an Animator (which clip, which frame, time on it). New clips or retimed
+    ones need no rebuild, only the file.
+*/
+typedef struct AnimationClip {
+    char name[CLIP_NAME_LENGTH];    // Name the game looks the clip up by
+    int sheet;                      // Atlas sprite id the frames come from (what Sprite components keep)
+    SpriteRef sprite;               // The same sprite resolved
+    int firstFrame;                 // First frame in the sprite (row * columns + column)
+    int frameCount;                 // Frames in the clip
+    float frameTime;                // Seconds on each frame
+    int next;                       // Clip played after the last frame (itself = loop, -1 = stop at the end)
+    AnimationEvent events[CLIP_MAX_EVENTS];
+    int eventCount;
+} AnimationClip;
+
+// Playback state of one actor - all it needs, the rest is in the clip
+typedef struct Animator {
+    int clip;                       // Clip id (-1 = none)
+    int frame;                      // Frame within the clip (frameCount once a stopping clip is done)
+    float time;                     // Time on the current frame
+} Animator;
+
+// Function declarations - clip registry (one per process, loaded after the sprite atlas)
+bool LoadAnimationClips(const char *path);          // Reads the clip file (false if it can't be read)
+void UnloadAnimationClips(void);
+int FindAnimationClip(const char *name);            // Clip id (-1 if there is no such clip)
+int FindAnimationEvent(const char *name);           // Event id (-1 if no clip uses it)
+const AnimationClip *GetAnimationClip(int clip);    // NULL for -1 or an unknown id
+
+// Function declarations - playback
+Animator StartAnimation(int clip);                  // Animator at the clip's first frame
+void PlayAnimation(Animator *animator, int clip);   // Switch clips (nothing happens if it is already playing)
+unsigned int AdvanceAnimation(Animator *animator, float delta); // Step time, returns the bits of the events fired
+bool IsAnimationFinished(const Animator *animator); // A stopping clip reached its end (or there is no clip)
+bool IsAnimationOneShot(const Animator *animator);  // Playing a clip that doesn't loop and hasn't finished
+int GetAnimationSpriteFrame(const Animator *animator); // Frame to draw from the clip's sprite (last one once finished)
+
+#endif
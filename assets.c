@@ -0,0 +1,153 @@
+#include "assets.h"
+#include <string.h>
+
+// Texture cache - fixed table so Texture2D addresses stay valid while cached
+static TextureAsset textureAssets[MAX_TEXTURE_ASSETS];
+static bool headlessAssets;  // No GL context - entries keep sizes only (texture id 0)
+
+// What GetTexture hands out for an invalid handle (cache full, never acquired) - id 0 draws
+// nothing, and the 1x1 size keeps anything sized or UV-mapped from it finite
+static Texture2D placeholderTexture = { 0, 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+
+// Texture for a decoded image - only its size when headless (the image stays owned by the caller)
+static Texture2D texture_from_image(Image image) {
+    if (headlessAssets) return (Texture2D){ 0, image.width, image.height, image.mipmaps, image.format };
+    return LoadTextureFromImage(image);
+}
+
+// Texture for an image file (id 0 if it can't be read)
+static Texture2D texture_from_file(const char *path) {
+    if (!headlessAssets) return LoadTexture(path);
+    Image image = LoadImage(path);
+    Texture2D texture = texture_from_image(image);
+    UnloadImage(image);
+    return texture;
+}
+
+void SetHeadlessAssets(bool headless) {
+    headlessAssets = headless;
+}
+
+// Handle refers to a cached texture
+static bool valid_handle(AssetHandle handle) {
+    return handle > 0 && handle <= MAX_TEXTURE_ASSETS && textureAssets[handle - 1].used;
+}
+
+// Find the cache slot holding a key (-1 if not cached)
+static int FindSlot(const char *path) {
+    for (int i = 0; i < MAX_TEXTURE_ASSETS; i++) {
+        if (textureAssets[i].used && strcmp(textureAssets[i].path, path) == 0) return i;
+    }
+    return -1;
+}
+
+// Claim an empty slot for a new texture (-1 if the cache is full)
+static int AddSlot(const char *path, Texture2D texture) {
+    for (int i = 0; i < MAX_TEXTURE_ASSETS; i++) {
+        if (!textureAssets[i].used) {
+            TextureAsset *asset = &textureAssets[i];
+            memset(asset, 0, sizeof(*asset));
+            strncpy(asset->path, path, ASSET_PATH_LENGTH - 1);
+            asset->texture = texture;
+            asset->used = true;
+            return i;
+        }
+    }
+    TraceLog(LOG_WARNING, "ASSETS: Cache full, cannot add %s", path);
+    UnloadTexture(texture);
+    return -1;
+}
+
+// Get a reference to a texture file, loading it on first use
+AssetHandle AcquireTexture(const char *path) {
+    int slot = FindSlot(path);
+    if (slot < 0) slot = AddSlot(path, texture_from_file(path));
+    if (slot < 0) return 0;
+    textureAssets[slot].refCount++;
+    return slot + 1;
+}
+
+// Get a reference to a generated texture, generating it on first use
+AssetHandle AcquireGeneratedTexture(const char *key, Image (*generate)(void)) {
+    int slot = FindSlot(key);
+    if (slot < 0) {
+        Image image = generate();
+        slot = AddSlot(key, texture_from_image(image));
+        UnloadImage(image);
+    }
+    if (slot < 0) return 0;
+    textureAssets[slot].refCount++;
+    return slot + 1;
+}
+
+// Get a reference to a texture, uploading an already decoded image on first use (the image stays owned by the caller)
+AssetHandle AcquireTextureFromImage(const char *path, Image image) {
+    int slot = FindSlot(path);
+    if (slot < 0) slot = AddSlot(path, texture_from_image(image));
+    if (slot < 0) return 0;
+    textureAssets[slot].refCount++;
+    return slot + 1;
+}
+
+// Load a texture ahead of time and keep it resident
+void PreloadTexture(const char *path) {
+    AssetHandle handle = AcquireTexture(path);
+    KeepTextureResident(handle);
+    ReleaseTexture(handle);
+}
+
+// Mark a cached texture as resident
+void KeepTextureResident(AssetHandle handle) {
+    if (valid_handle(handle)) textureAssets[handle - 1].resident = true;
+}
+
+// Look up a texture by handle
+Texture2D *GetTexture(AssetHandle handle) {
+    if (!valid_handle(handle)) return &placeholderTexture;
+    return &textureAssets[handle - 1].texture;
+}
+
+// Map a texture pointer back to its handle (used by the libtmx free callback)
+AssetHandle FindTextureHandle(const Texture2D *texture) {
+    for (int i = 0; i < MAX_TEXTURE_ASSETS; i++) {
+        if (textureAssets[i].used && &textureAssets[i].texture == texture) return i + 1;
+    }
+    return 0;
+}
+
+// Look up the key of a handle
+const char *GetTexturePath(AssetHandle handle) {
+    return valid_handle(handle) ? textureAssets[handle - 1].path : NULL;
+}
+
+// Swap in fresh pixels for a cached file (hot reload)
+bool ReloadTextureFile(const char *path) {
+    int slot = FindSlot(path);
+    if (slot < 0) return false;
+    Texture2D texture = texture_from_file(path);
+    if (texture.width == 0) return false;  // Half-written file - keep the old pixels
+    UnloadTexture(textureAssets[slot].texture);
+    textureAssets[slot].texture = texture;
+    return true;
+}
+
+// Drop a reference and unload the texture when it is no longer needed
+void ReleaseTexture(AssetHandle handle) {
+    if (!valid_handle(handle)) return;
+    TextureAsset *asset = &textureAssets[handle - 1];
+    if (asset->refCount > 0) asset->refCount--;
+    if (asset->refCount == 0 && !asset->resident) {
+        UnloadTexture(asset->texture);
+        asset->used = false;
+    }
+}
+
+// Unload everything in the cache
+void UnloadAllTextures(void) {
+    for (int i = 0; i < MAX_TEXTURE_ASSETS; i++) {
+        if (textureAssets[i].used) {
+            UnloadTexture(textureAssets[i].texture);
+            textureAssets[i].used = false;
+        }
+    }
+}
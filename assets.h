@@ -0,0 +1,65 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+// Include necessary libraries
+#include "raylib.h"  // Texture2D type and texture loading
+
+// Asset cache constants
+#define MAX_TEXTURE_ASSETS 64    // Maximum number of distinct textures in the cache
+#define ASSET_PATH_LENGTH 256    // Maximum length of a texture path / key
+
+// Handle to a cached texture (0 = no texture)
+typedef int AssetHandle;
+
+// Cached texture entry
+typedef struct TextureAsset {
+    char path[ASSET_PATH_LENGTH];  // Key the texture was loaded under
+    Texture2D texture;             // GPU texture (address stays fixed while cached)
+    int refCount;                  // Number of owners holding the handle
+    bool resident;                 // Keep loaded at refCount 0 (preloaded / reused across restarts)
+    bool used;                     // Slot holds a texture
+} TextureAsset;
+
+// Function declarations - texture cache
+
+// Headless runs (no window / GL context): files are still decoded, but only their size is kept
+// (texture id 0), so anything sized from a texture - atlas frames, projectile bodies - works the same.
+// Set before the first texture is acquired
+void SetHeadlessAssets(bool headless);
+
+// Returns a handle to the texture at path, loading it only on first use. Release with ReleaseTexture
+AssetHandle AcquireTexture(const char *path);
+
+// Same as AcquireTexture, but the texture is uploaded from the image generate() returns instead of read from disk
+AssetHandle AcquireGeneratedTexture(const char *key, Image (*generate)(void));
+
+// Same as AcquireTexture, but uploads an image decoded elsewhere (e.g. on a loader thread) when not cached yet
+AssetHandle AcquireTextureFromImage(const char *path, Image image);
+
+// Loads the texture now and keeps it resident even when nobody holds it (no reference is returned)
+void PreloadTexture(const char *path);
+
+// Keeps an already cached texture resident when its reference count drops to zero
+void KeepTextureResident(AssetHandle handle);
+
+// Returns the cached texture for a handle (stable pointer). An invalid handle - e.g. 0 from a full
+// cache - gets a shared 1x1 placeholder with id 0, which draws nothing, so callers never see NULL
+Texture2D *GetTexture(AssetHandle handle);
+
+// Finds the handle owning a texture pointer previously returned by GetTexture (0 if unknown)
+AssetHandle FindTextureHandle(const Texture2D *texture);
+
+// Path / key a handle was acquired with (NULL for an invalid handle)
+const char *GetTexturePath(AssetHandle handle);
+
+// Reloads a cached texture from its file in place - handles and texture pointers stay valid.
+// Returns false if nothing is cached under path or the file can't be read (the old texture is kept)
+bool ReloadTextureFile(const char *path);
+
+// Drops one reference - the texture is unloaded at zero unless it is resident
+void ReleaseTexture(AssetHandle handle);
+
+// Unloads every cached texture, resident or not (call before closing the window)
+void UnloadAllTextures(void);
+
+#endif
@@ -0,0 +1,187 @@
+#include "atlas.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Runtime atlas used by the game
+static SpriteAtlas spriteAtlas;
+
+// Read the manifest - one "name image columns rows count" line per sprite, '#' starts a comment
+int LoadSpriteManifest(const char *path, SpriteManifestEntry *entries, int maxEntries) {
+    FILE *file = fopen(path, "r");
+    if (!file) return -1;
+
+    int count = 0;
+    char line[512];
+    while (fgets(line, sizeof(line), file) && count < maxEntries) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        SpriteManifestEntry *e = &entries[count];
+        if (sscanf(line, "%31s %255s %d %d %d", e->name, e->image, &e->columns, &e->rows, &e->count) == 5) {
+            count++;
+        }
+    }
+    fclose(file);
+    return count;
+}
+
+/*
+    Write the frame table sidecar:
+        atlas 1
+        page <file>                       (one per page)
+        sprite <name> <page> <columns> <frameCount>
+        <x> <y> <w> <h>                   (one per frame)
+*/
+bool SaveSpriteAtlas(const SpriteAtlas *atlas, const char *path) {
+    FILE *file = fopen(path, "w");
+    if (!file) return false;
+
+    fprintf(file, "atlas 1\n");
+    for (int p = 0; p < atlas->pageCount; p++) {
+        fprintf(file, "page %s\n", atlas->pagePaths[p]);
+    }
+    for (int s = 0; s < atlas->spriteCount; s++) {
+        const AtlasSprite *sprite = &atlas->sprites[s];
+        fprintf(file, "sprite %s %d %d %d\n", sprite->name, sprite->page, sprite->columns, sprite->frameCount);
+        for (int f = 0; f < sprite->frameCount; f++) {
+            Rectangle r = atlas->frames[sprite->firstFrame + f];
+            fprintf(file, "%d %d %d %d\n", (int)r.x, (int)r.y, (int)r.width, (int)r.height);
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+// Parse a packed atlas sidecar into the runtime atlas
+static bool ReadAtlasFile(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) return false;
+
+    char line[512];
+    int version = 0;
+    if (!fgets(line, sizeof(line), file) || sscanf(line, "atlas %d", &version) != 1 || version != 1) {
+        fclose(file);
+        return false;
+    }
+
+    int capacity = 0;
+    AtlasSprite *sprite = NULL;
+    while (fgets(line, sizeof(line), file)) {
+        char name[ASSET_PATH_LENGTH];
+        int page, columns, count;
+        float x, y, w, h;
+        if (sscanf(line, "page %255s", name) == 1 && spriteAtlas.pageCount < MAX_ATLAS_PAGES) {
+            strcpy(spriteAtlas.pagePaths[spriteAtlas.pageCount++], name);
+        } else if (sscanf(line, "sprite %31s %d %d %d", name, &page, &columns, &count) == 4 &&
+                   spriteAtlas.spriteCount < MAX_ATLAS_SPRITES) {
+            sprite = &spriteAtlas.sprites[spriteAtlas.spriteCount++];
+            strcpy(sprite->name, name);
+            sprite->page = page;
+            sprite->columns = columns;
+            sprite->firstFrame = spriteAtlas.frameCount;
+            sprite->frameCount = 0;
+        } else if (sprite && sscanf(line, "%f %f %f %f", &x, &y, &w, &h) == 4) {
+            if (spriteAtlas.frameCount == capacity) {
+                capacity = capacity ? capacity * 2 : 64;
+                spriteAtlas.frames = realloc(spriteAtlas.frames, capacity * sizeof(Rectangle));
+            }
+            spriteAtlas.frames[spriteAtlas.frameCount++] = (Rectangle){ x, y, w, h };
+            sprite->frameCount++;
+        }
+    }
+    fclose(file);
+    return spriteAtlas.spriteCount > 0;
+}
+
+// Build the frame table straight from the manifest - every sheet becomes its own page
+static bool BuildAtlasFromManifest(const char *path) {
+    SpriteManifestEntry entries[MAX_ATLAS_SPRITES];
+    int count = LoadSpriteManifest(path, entries, MAX_ATLAS_SPRITES);
+    if (count <= 0 || count > MAX_ATLAS_PAGES) return false;
+
+    int totalFrames = 0;
+    for (int i = 0; i < count; i++) totalFrames += entries[i].count;
+    spriteAtlas.frames = malloc(totalFrames * sizeof(Rectangle));
+
+    for (int i = 0; i < count; i++) {
+        SpriteManifestEntry *e = &entries[i];
+        strcpy(spriteAtlas.pagePaths[i], e->image);
+        spriteAtlas.pageCount++;
+
+        // Frame size comes from the sheet size and its grid (the atlas keeps this reference)
+        spriteAtlas.pages[i] = AcquireTexture(e->image);
+        Texture2D *sheet = GetTexture(spriteAtlas.pages[i]);
+        float frameW = (float)(sheet->width / e->columns);
+        float frameH = (float)(sheet->height / e->rows);
+
+        AtlasSprite *sprite = &spriteAtlas.sprites[spriteAtlas.spriteCount++];
+        strcpy(sprite->name, e->name);
+        sprite->page = i;
+        sprite->columns = e->columns;
+        sprite->firstFrame = spriteAtlas.frameCount;
+        sprite->frameCount = e->count;
+        for (int f = 0; f < e->count; f++) {
+            spriteAtlas.frames[spriteAtlas.frameCount++] = (Rectangle){
+                (f % e->columns) * frameW,
+                (f / e->columns) * frameH,
+                frameW,
+                frameH
+            };
+        }
+    }
+    return true;
+}
+
+// Load the packed atlas (or the loose-sheet fallback) and acquire its page textures
+bool LoadSpriteAtlas(const char *atlasPath, const char *manifestPath) {
+    memset(&spriteAtlas, 0, sizeof(spriteAtlas));
+    if (ReadAtlasFile(atlasPath)) {
+        for (int p = 0; p < spriteAtlas.pageCount; p++) {
+            spriteAtlas.pages[p] = AcquireTexture(spriteAtlas.pagePaths[p]);
+        }
+        return true;
+    }
+
+    // No packed atlas yet - fall back to the source sheets
+    UnloadSpriteAtlas();
+    TraceLog(LOG_WARNING, "ATLAS: %s not found, using sheets from %s", atlasPath, manifestPath);
+    if (!BuildAtlasFromManifest(manifestPath)) {
+        TraceLog(LOG_ERROR, "ATLAS: Failed to load %s", manifestPath);
+        return false;
+    }
+    return true;
+}
+
+// Find a sprite's id by name
+int FindSprite(const char *name) {
+    for (int s = 0; s < spriteAtlas.spriteCount; s++) {
+        if (strcmp(spriteAtlas.sprites[s].name, name) == 0) return s;
+    }
+    TraceLog(LOG_WARNING, "ATLAS: Unknown sprite %s", name);
+    return -1;
+}
+
+// Resolve a sprite id to its page and frames
+SpriteRef GetSpriteById(int id) {
+    if (id < 0 || id >= spriteAtlas.spriteCount) return (SpriteRef){ 0, NULL, 1, 0 };
+    const AtlasSprite *sprite = &spriteAtlas.sprites[id];
+    return (SpriteRef){
+        spriteAtlas.pages[sprite->page],
+        &spriteAtlas.frames[sprite->firstFrame],
+        sprite->columns,
+        sprite->frameCount
+    };
+}
+
+// Find a sprite by name
+SpriteRef GetSprite(const char *name) {
+    return GetSpriteById(FindSprite(name));
+}
+
+// Release the page textures and the frame table
+void UnloadSpriteAtlas(void) {
+    for (int p = 0; p < spriteAtlas.pageCount; p++) {
+        ReleaseTexture(spriteAtlas.pages[p]);
+    }
+    free(spriteAtlas.frames);
+    memset(&spriteAtlas, 0, sizeof(spriteAtlas));
+}
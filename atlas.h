@@ -0,0 +1,77 @@
+#ifndef ATLAS_H
+#define ATLAS_H
+
+// Include necessary libraries
+#include "raylib.h"  // Rectangle, Image and texture types
+#include "assets.h"  // Atlas pages live in the asset cache
+
+// Atlas constants
+#define SPRITE_ATLAS_PATH "sprites.atlas"        // Frame table written by the atlas packer
+#define SPRITE_MANIFEST_PATH "sprites.manifest"  // Source sprite sheets the atlas is built from
+#define MAX_ATLAS_SPRITES 32     // Maximum number of named sprites
+#define MAX_ATLAS_PAGES 8        // Maximum number of atlas textures
+#define SPRITE_NAME_LENGTH 32    // Maximum sprite name length
+#define ATLAS_PAGE_SIZE 1024     // Width/height of a packed atlas page in pixels
+#define ATLAS_PADDING 2          // Empty pixels between packed frames
+
+// One sprite sheet listed in the manifest
+typedef struct SpriteManifestEntry {
+    char name[SPRITE_NAME_LENGTH];   // Name the game looks the sprite up by
+    char image[ASSET_PATH_LENGTH];   // Source sprite sheet
+    int columns, rows;               // Frame grid of the sheet
+    int count;                       // Frames actually used (row-major, <= columns * rows)
+} SpriteManifestEntry;
+
+// Named run of frames - all frames of a sprite sit on the same page
+typedef struct AtlasSprite {
+    char name[SPRITE_NAME_LENGTH];   // Sprite name
+    int page;                        // Page holding the frames
+    int columns;                     // Frames per row in the source sheet (row * columns + col = frame)
+    int firstFrame;                  // Index of the first frame in the frame table
+    int frameCount;                  // Number of frames
+} AtlasSprite;
+
+// Sprite atlas - pages plus a frame table
+typedef struct SpriteAtlas {
+    char pagePaths[MAX_ATLAS_PAGES][ASSET_PATH_LENGTH];  // Page image files
+    AssetHandle pages[MAX_ATLAS_PAGES];                  // Page textures (runtime only)
+    int pageCount;
+    AtlasSprite sprites[MAX_ATLAS_SPRITES];              // Named sprites
+    int spriteCount;
+    Rectangle *frames;                                   // Frame rectangles inside their page
+    int frameCount;
+} SpriteAtlas;
+
+// Resolved sprite - what entities keep to draw frames
+typedef struct SpriteRef {
+    AssetHandle texture;        // Page texture the frames are cut from
+    const Rectangle *frames;    // Frame rectangles (owned by the atlas)
+    int columns;                // Frames per row in the source sheet
+    int frameCount;             // Number of frames
+} SpriteRef;
+
+// Function declarations - shared by the packer and the game
+
+// Reads the sprite manifest, returns the number of entries (-1 if the file can't be read)
+int LoadSpriteManifest(const char *path, SpriteManifestEntry *entries, int maxEntries);
+
+// Writes the frame table sidecar for a packed atlas
+bool SaveSpriteAtlas(const SpriteAtlas *atlas, const char *path);
+
+// Function declarations - runtime atlas
+
+// Loads the packed atlas, or builds the same frame table from the manifest's loose sheets if it is missing
+bool LoadSpriteAtlas(const char *atlasPath, const char *manifestPath);
+
+// Looks up a sprite by name (frameCount is 0 if it doesn't exist)
+SpriteRef GetSprite(const char *name);
+
+// Sprite ids - what state that gets saved keeps instead of a SpriteRef (ids stay valid as long as
+// the manifest doesn't change, pointers only until the atlas is reloaded)
+int FindSprite(const char *name);   // -1 if it doesn't exist
+SpriteRef GetSpriteById(int id);    // frameCount is 0 for -1 or an unknown id
+
+// Releases the atlas pages and frame table
+void UnloadSpriteAtlas(void);
+
+#endif
@@ -0,0 +1,125 @@
+#include "raylib.h"
+#include "atlas.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+    Offline atlas packer
+        -reads the sprite manifest (name, sheet, frame grid)
+        -cuts every sheet into frames and shelf-packs them into ATLAS_PAGE_SIZE pages
+        -keeps all frames of a sprite on one page
+        -writes <out>_<n>.png pages and the <out>.atlas frame table
+    Runs without a window (image work only).
+*/
+
+// Shelf packing cursor
+typedef struct PackCursor {
+    int x, y;       // Next free position on the current shelf
+    int shelfH;     // Height of the current shelf
+} PackCursor;
+
+// Advance the cursor for one frame, returns its position (y < 0 if the page is full)
+static Vector2 PlaceFrame(PackCursor *cursor, int w, int h) {
+    if (cursor->x + w + ATLAS_PADDING > ATLAS_PAGE_SIZE) {
+        // Start a new shelf
+        cursor->x = ATLAS_PADDING;
+        cursor->y += cursor->shelfH + ATLAS_PADDING;
+        cursor->shelfH = 0;
+    }
+    if (cursor->y + h + ATLAS_PADDING > ATLAS_PAGE_SIZE) return (Vector2){ -1, -1 };
+
+    Vector2 pos = { (float)cursor->x, (float)cursor->y };
+    cursor->x += w + ATLAS_PADDING;
+    if (h > cursor->shelfH) cursor->shelfH = h;
+    return pos;
+}
+
+// Check whether a whole sprite fits on the current page
+static bool SpriteFits(PackCursor cursor, int w, int h, int count) {
+    for (int f = 0; f < count; f++) {
+        if (PlaceFrame(&cursor, w, h).y < 0) return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        printf("Usage: %s <sprites.manifest> <output name>\n", argv[0]);
+        return 1;
+    }
+    SetTraceLogLevel(LOG_WARNING);
+
+    SpriteManifestEntry entries[MAX_ATLAS_SPRITES];
+    int count = LoadSpriteManifest(argv[1], entries, MAX_ATLAS_SPRITES);
+    if (count <= 0) {
+        printf("Could not read manifest %s\n", argv[1]);
+        return 1;
+    }
+
+    SpriteAtlas atlas = { 0 };
+    Image pages[MAX_ATLAS_PAGES];
+    int totalFrames = 0;
+    for (int i = 0; i < count; i++) totalFrames += entries[i].count;
+    atlas.frames = malloc(totalFrames * sizeof(Rectangle));
+
+    PackCursor cursor = { 0 };
+    for (int i = 0; i < count; i++) {
+        SpriteManifestEntry *e = &entries[i];
+        Image sheet = LoadImage(e->image);
+        if (sheet.data == NULL) {
+            printf("Could not load %s\n", e->image);
+            return 1;
+        }
+        int frameW = sheet.width / e->columns;
+        int frameH = sheet.height / e->rows;
+
+        // Open a new page when the sprite doesn't fit on the current one
+        if (atlas.pageCount == 0 || !SpriteFits(cursor, frameW, frameH, e->count)) {
+            if (atlas.pageCount == MAX_ATLAS_PAGES) {
+                printf("Too many atlas pages\n");
+                return 1;
+            }
+            pages[atlas.pageCount++] = GenImageColor(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, BLANK);
+            cursor = (PackCursor){ ATLAS_PADDING, ATLAS_PADDING, 0 };
+            if (!SpriteFits(cursor, frameW, frameH, e->count)) {
+                printf("%s does not fit on one %dx%d page\n", e->name, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+                return 1;
+            }
+        }
+
+        AtlasSprite *sprite = &atlas.sprites[atlas.spriteCount++];
+        strcpy(sprite->name, e->name);
+        sprite->page = atlas.pageCount - 1;
+        sprite->columns = e->columns;
+        sprite->firstFrame = atlas.frameCount;
+        sprite->frameCount = e->count;
+
+        // Copy every frame into the page
+        for (int f = 0; f < e->count; f++) {
+            Vector2 pos = PlaceFrame(&cursor, frameW, frameH);
+            Rectangle src = { (f % e->columns) * frameW, (f / e->columns) * frameH, frameW, frameH };
+            Rectangle dst = { pos.x, pos.y, frameW, frameH };
+            ImageDraw(&pages[sprite->page], sheet, src, dst, WHITE);
+            atlas.frames[atlas.frameCount++] = dst;
+        }
+        UnloadImage(sheet);
+    }
+
+    // Write pages and the frame table
+    for (int p = 0; p < atlas.pageCount; p++) {
+        snprintf(atlas.pagePaths[p], ASSET_PATH_LENGTH, "%s_%d.png", argv[2], p);
+        ExportImage(pages[p], atlas.pagePaths[p]);
+        UnloadImage(pages[p]);
+    }
+    char atlasPath[ASSET_PATH_LENGTH];
+    snprintf(atlasPath, sizeof(atlasPath), "%s.atlas", argv[2]);
+    if (!SaveSpriteAtlas(&atlas, atlasPath)) {
+        printf("Could not write %s\n", atlasPath);
+        return 1;
+    }
+
+    printf("Packed %d sprites (%d frames) into %d page(s): %s\n", atlas.spriteCount, atlas.frameCount, atlas.pageCount, atlasPath);
+    free(atlas.frames);
+    return 0;
+}
@@ -1,38 +1,68 @@
 #include "boss.h"
+#include "broadphase.h"
+#include "particles.h"
 #include <raymath.h>
 #include <stdlib.h>
 #include <math.h>
 
-// Initialize the boss with starting values and load resources
-void InitBoss(Boss *boss, Vector2 position, tmx_map *map) {
-    // Set position and remember spawn point for movement boundaries
-    boss->position = position;
-    boss->spawn = position;
-    
+#define BOSS_HEALTH 10000
+
+// Point the sprite at the frame to draw - movement frames while alive, then the death animation
+static void sync_sprite(Sprite *sprite, const BossAi *boss, const Transform *transform) {
+    if (boss->isDead) {
+        const AnimationClip *clip = GetAnimationClip(boss->death.clip);
+        if (clip) sprite->sheet = clip->sheet;
+        sprite->frame = GetAnimationSpriteFrame(&boss->death);
+        sprite->flipX = false;
+        sprite->visible = !IsAnimationFinished(&boss->death);  // Gone once it has played
+        return;
+    }
+
+    // The old left-facing sheet was the whole right-facing sheet mirrored, so frame order
+    // runs backwards when facing left; flipping the frame then matches the player sprite
+    const AnimationClip *clip = GetAnimationClip(boss->move.clip);
+    if (clip) sprite->sheet = clip->sheet;
+    sprite->frame = GetAnimationSpriteFrame(&boss->move);
+    if (clip && !transform->facingRight) sprite->frame = clip->firstFrame + clip->frameCount - 1 - boss->move.frame;
+    sprite->flipX = !transform->facingRight;
+    sprite->visible = true;
+}
+
+// Create the boss entity with starting values
+EntityHandle SpawnBoss(World *world, Vector2 position) {
+    EntityHandle entity = CreateEntity(world);
+
+    // Set position - the spawn point (kept in the AI) is the centre of the movement bounds
+    Transform *transform = AddComponent(world, entity, COMPONENT_TRANSFORM);
+    transform->position = position;
+    transform->previousPosition = position;
+    transform->scale = BOSS_SCALE;
+    transform->facingRight = false;      // Start facing left
+
     // Set boss stats - high health pool for challenging fight
-    boss->health = 10000;
+    Health *health = AddComponent(world, entity, COMPONENT_HEALTH);
+    health->current = BOSS_HEALTH;
+    health->max = BOSS_HEALTH;
+    health->barColor = RED;
+
+    Ai *ai = AddComponent(world, entity, COMPONENT_AI);
+    ai->kind = AI_BOSS;
+    BossAi *boss = &ai->boss;
+    boss->spawn = position;
     boss->speed = 100;
-    
-    // Animation system - controls sprite frame updates
-    boss->frame = 0;              // Start at first animation frame
-    boss->frameTime = 0.15f;      // Each frame lasts 0.15 seconds (~6-7 FPS)
-    boss->frameCounter = 0;       // Timer for advancing frames
+
+    // Animation clips - movement loops, death plays once health runs out
+    boss->move = StartAnimation(FindAnimationClip("boss_move"));
+    boss->death = StartAnimation(FindAnimationClip("boss_death"));
     
     // Dash attack system - boss charges at player
     boss->dashCooldown = 3.0f;    // Can dash every 3 seconds
+    boss->dashTimer = 0.0f;       // Time since the last dash
     boss->dashSpeed = 500.0f;     // Very fast movement during dash
     boss->isDashing = false;      // Not currently dashing
-    
-    // Death animation system - plays when boss is defeated
-    boss->isDead = false;                // Boss starts alive
-    boss->deathAnimPlaying = false;      // Death animation not active
-    boss->deathFrame = 0;                // Start death anim at frame 0
-    boss->deathFrameCounter = 0;         // Timer for death animation
-    boss->deathFrameTime = 0.12f;        // Speed of death animation
-    boss->deathFinished = false;         // Death anim hasn't completed
+    boss->isDead = false;         // Boss starts alive
     
     // Movement and AI behavior
-    boss->facingRight = false;           // Start facing left
     boss->zigzagTimer = 0.0f;            // Timer for zigzag movement pattern
     boss->zigzagAmplitude = 50.0f;       // How wide the zigzag movement is
     boss->zigzagFrequency = 2.0f;        // How fast the zigzag oscillates
@@ -40,18 +70,43 @@ void InitBoss(Boss *boss, Vector2 position, tmx_map *map) {
     boss->teleportCooldown = 2.0f;       // Cooldown between teleports
     boss->isFlying = false;              // Starts on ground
 
-    // Load boss attack skill textures - different for left/right facing
-    boss->skillRight = LoadTexture("skill1.png");  // Right-facing attack sprites
-    boss->skillLeft = LoadTexture("skill2.png");   // Left-facing attack sprites
+    // Collision box - the first movement frame scaled to draw size
+    Collider *collider = AddComponent(world, entity, COMPONENT_COLLIDER);
+    const AnimationClip *clip = GetAnimationClip(boss->move.clip);
+    Rectangle frame = clip && clip->frameCount > 0 ? clip->sprite.frames[clip->firstFrame] : (Rectangle){0};
+    collider->size = (Vector2){frame.width * BOSS_SCALE, frame.height * BOSS_SCALE};
+    collider->kind = BODY_BOSS;
+    collider->mask = BODY_PLAYER;
+    collider->enabled = true;
+
+    Sprite *sprite = AddComponent(world, entity, COMPONENT_SPRITE);
+    sprite->sheet = -1;
+    sprite->depth = 1;
+    sync_sprite(sprite, boss, transform);
+    return entity;
 }
 
-// Update boss logic each frame - handles AI, movement, attacks, and phase changes
-void UpdateBoss(Boss *boss, float delta, tmx_map *map) {
+// One boss tick - handles AI, movement, attacks, and phase changes
+static void update_boss(BossAi *boss, Transform *transform, Health *health, const Collider *collider,
+                        float delta, const Level *level, Rng *rng) {
+    transform->previousPosition = transform->position;
+
     // Check if boss has been defeated
-    if (boss->health <= 0) {
+    if (health->current <= 0) {
+        // Smoke and fire for as long as the death animation plays
+        if (!boss->isDead) {
+            const AnimationClip *clip = GetAnimationClip(boss->death.clip);
+            Vector2 centre = { transform->position.x + collider->size.x / 2, transform->position.y + collider->size.y / 2 };
+            EmitParticles(PARTICLE_BOSS_DEATH, centre, -PI / 2, BOSS_DEATH_BURST);
+            StartParticleEmitter(PARTICLE_BOSS_DEATH, centre, -PI / 2, BOSS_DEATH_PARTICLE_RATE,
+                                 clip ? clip->frameCount * clip->frameTime : 1.0f);
+        }
         boss->speed = 0;         // Stop all movement
         boss->isDashing = false; // Cancel any active dash
         boss->isDead = true;     // Mark as dead
+
+        // Death animation (stops after its last frame)
+        AdvanceAnimation(&boss->death, delta);
         return;                  // Skip further updates
     }
 
@@ -59,14 +114,14 @@ void UpdateBoss(Boss *boss, float delta, tmx_map *map) {
     // This creates a multi-phase boss fight that gets harder over time
     
     // Phase 1: Health above 5000 - Basic movement pattern
-    if (boss->health > 5000) {
+    if (health->current > 5000) {
         boss->phase = 1;
         boss->speed = 100;              // Normal speed
         boss->zigzagFrequency = 2.0f;   // Standard zigzag
         boss->isFlying = false;         // Ground-based movement
     } 
     // Phase 2: Health between 2000-5000 - Gains new abilities
-    else if (boss->health > 2000) {
+    else if (health->current > 2000) {
         boss->phase = 2;
         boss->speed = 120;              // Faster movement
         boss->zigzagFrequency = 2.0f;
@@ -82,9 +137,8 @@ void UpdateBoss(Boss *boss, float delta, tmx_map *map) {
         boss->teleportCooldown = 2.0f;  // Teleports more frequently
     }
 
-    // Calculate boss collision dimensions based on texture size
-    float bossWidth = (boss->skillRight.width / 6) * 1.8f;  // Width based on 6-frame animation
-    float bossHeight = boss->skillRight.height * 1.8f;      // Height with scaling
+    // Boss collision height (ground level is measured from the bottom of the sprite)
+    float bossHeight = collider->size.y;
     
     // Define movement boundaries relative to spawn point
     float leftBound = boss->spawn.x - 800.0f;   // Can move 800 units left of spawn
@@ -107,15 +161,15 @@ void UpdateBoss(Boss *boss, float delta, tmx_map *map) {
     if (boss->phase == 3) {
         // Teleport ability: 20% chance to teleport when cooldown is ready
         if (boss->teleportTimer >= boss->teleportCooldown) {
-            if (rand() % 100 < 20) {  // 20% probability
+            if (RngRange(rng, 100) < 20) {  // 20% probability
                 // Teleport to random position within movement boundaries
-                boss->position.x = leftBound + (float)(rand() % (int)(rightBound - leftBound));
-                boss->position.y = topBound + (float)(rand() % (int)(bottomBound - topBound));
+                transform->position.x = leftBound + (float)RngRange(rng, (int)(rightBound - leftBound));
+                transform->position.y = topBound + (float)RngRange(rng, (int)(bottomBound - topBound));
                 
                 // Ensure boss doesn't fly too close to the ground
-                float groundLevel = map->height * map->tile_height - bossHeight;
-                if (boss->position.y < groundLevel - 200.0f) {
-                    boss->position.y = groundLevel - 200.0f;  // Minimum flying height
+                float groundLevel = GetLevelPixelHeight(level) - bossHeight;
+                if (transform->position.y < groundLevel - 200.0f) {
+                    transform->position.y = groundLevel - 200.0f;  // Minimum flying height
                 }
             }
             boss->teleportTimer = 0.0f;  // Reset teleport timer
@@ -130,8 +184,8 @@ void UpdateBoss(Boss *boss, float delta, tmx_map *map) {
         // Handle dash movement
         if (boss->isDashing) {
             // Dash in the direction the boss is facing
-            float dashDir = boss->facingRight ? 1 : -1;
-            boss->position.x += dashDir * boss->dashSpeed * delta;
+            float dashDir = transform->facingRight ? 1 : -1;
+            transform->position.x += dashDir * boss->dashSpeed * delta;
             
             // Dash lasts for 0.5 seconds
             if (boss->dashTimer > 0.5f) {
@@ -142,47 +196,48 @@ void UpdateBoss(Boss *boss, float delta, tmx_map *map) {
         // Normal movement with zigzag pattern
         else {
             // Basic movement in facing direction
-            float dir = boss->facingRight ? 1 : -1;
-            boss->position.x += dir * boss->speed * delta;
+            float dir = transform->facingRight ? 1 : -1;
+            transform->position.x += dir * boss->speed * delta;
             
-            // Add horizontal zigzag movement using sine wave
+            // Add horizontal zigzag movement using sine wave (a per-step offset, scaled so it
+            // moves the same distance per second at any tick rate)
             float zigzagOffsetX = boss->zigzagAmplitude * sinf(boss->zigzagTimer * boss->zigzagFrequency);
-            boss->position.x += zigzagOffsetX;
+            transform->position.x += zigzagOffsetX * delta * BOSS_ZIGZAG_STEP_RATE;
             
             // Add vertical zigzag movement for flying effect (smaller amplitude)
             float zigzagOffsetY = boss->zigzagAmplitude * 0.2f * sinf(boss->zigzagTimer * boss->zigzagFrequency * 0.5f);
-            boss->position.y += zigzagOffsetY;
+            transform->position.y += zigzagOffsetY * delta * BOSS_ZIGZAG_STEP_RATE;
 
             // Bounce off boundaries and change direction
-            if (boss->position.x < leftBound) {
-                boss->facingRight = true;   // Hit left wall, face right
-                boss->position.x = leftBound;
+            if (transform->position.x < leftBound) {
+                transform->facingRight = true;   // Hit left wall, face right
+                transform->position.x = leftBound;
             }
-            if (boss->position.x > rightBound) {
-                boss->facingRight = false;  // Hit right wall, face left
-                boss->position.x = rightBound;
+            if (transform->position.x > rightBound) {
+                transform->facingRight = false;  // Hit right wall, face left
+                transform->position.x = rightBound;
             }
         }
 
         // Constrain flying altitude - keep boss above ground but within bounds
-        float groundLevel = map->height * map->tile_height - bossHeight;
-        if (boss->position.y < groundLevel - 200.0f) {
-            boss->position.y = groundLevel - 200.0f;  // Minimum height
+        float groundLevel = GetLevelPixelHeight(level) - bossHeight;
+        if (transform->position.y < groundLevel - 200.0f) {
+            transform->position.y = groundLevel - 200.0f;  // Minimum height
         }
-        if (boss->position.y > groundLevel) {
-            boss->position.y = groundLevel;  // Maximum height (ground level)
+        if (transform->position.y > groundLevel) {
+            transform->position.y = groundLevel;  // Maximum height (ground level)
         }
         
         // Clamp final position to ensure it stays within defined boundaries
-        boss->position.x = Clamp(boss->position.x, leftBound, rightBound);
-        boss->position.y = Clamp(boss->position.y, topBound, bottomBound);
+        transform->position.x = Clamp(transform->position.x, leftBound, rightBound);
+        transform->position.y = Clamp(transform->position.y, topBound, bottomBound);
     }
     // PHASE 2 BEHAVIOR: Ground boss with teleport and dash abilities
     else if (boss->phase == 2) {
         // Teleport to random ground position when cooldown ready
         if (boss->teleportTimer >= boss->teleportCooldown) {
-            boss->position.x = leftBound + (float)(rand() % (int)(rightBound - leftBound));
-            boss->position.y = map->height * map->tile_height - bossHeight;  // Always on ground
+            transform->position.x = leftBound + (float)RngRange(rng, (int)(rightBound - leftBound));
+            transform->position.y = GetLevelPixelHeight(level) - bossHeight;  // Always on ground
             boss->teleportTimer = 0.0f;
         }
 
@@ -193,157 +248,74 @@ void UpdateBoss(Boss *boss, float delta, tmx_map *map) {
         }
 
         if (boss->isDashing) {
-            float dashDir = boss->facingRight ? 1 : -1;
-            boss->position.x += dashDir * boss->dashSpeed * delta;
+            float dashDir = transform->facingRight ? 1 : -1;
+            transform->position.x += dashDir * boss->dashSpeed * delta;
             if (boss->dashTimer > 0.5f) {
                 boss->isDashing = false;
                 boss->dashTimer = 0;
             }
         } else {
             // Normal movement with horizontal zigzag only (no vertical movement)
-            float dir = boss->facingRight ? 1 : -1;
-            boss->position.x += dir * boss->speed * delta;
+            float dir = transform->facingRight ? 1 : -1;
+            transform->position.x += dir * boss->speed * delta;
             float zigzagOffset = boss->zigzagAmplitude * sinf(boss->zigzagTimer * boss->zigzagFrequency);
-            boss->position.x += zigzagOffset;
+            transform->position.x += zigzagOffset * delta * BOSS_ZIGZAG_STEP_RATE;
 
             // Boundary bouncing
-            if (boss->position.x < leftBound) {
-                boss->facingRight = true;
-                boss->position.x = leftBound;
+            if (transform->position.x < leftBound) {
+                transform->facingRight = true;
+                transform->position.x = leftBound;
             }
-            if (boss->position.x > rightBound) {
-                boss->facingRight = false;
-                boss->position.x = rightBound;
+            if (transform->position.x > rightBound) {
+                transform->facingRight = false;
+                transform->position.x = rightBound;
             }
         }
 
         // Constrain to ground movement only
-        boss->position.x = Clamp(boss->position.x, leftBound, rightBound);
-        boss->position.y = map->height * map->tile_height - bossHeight;  // Lock to ground level
+        transform->position.x = Clamp(transform->position.x, leftBound, rightBound);
+        transform->position.y = GetLevelPixelHeight(level) - bossHeight;  // Lock to ground level
     }
     // PHASE 1 BEHAVIOR: Simple ground movement with boundary bouncing
     else if (boss->phase == 1) {
         // Basic left-right movement
-        float dir = boss->facingRight ? 1 : -1;
-        boss->position.x += dir * boss->speed * delta;
+        float dir = transform->facingRight ? 1 : -1;
+        transform->position.x += dir * boss->speed * delta;
 
         // Simple boundary detection and direction change
-        if (boss->position.x < leftBound) {
-            boss->facingRight = true;   // Hit left wall, turn right
-            boss->position.x = leftBound;
+        if (transform->position.x < leftBound) {
+            transform->facingRight = true;   // Hit left wall, turn right
+            transform->position.x = leftBound;
         }
-        if (boss->position.x > rightBound) {
-            boss->facingRight = false;  // Hit right wall, turn left
-            boss->position.x = rightBound;
+        if (transform->position.x > rightBound) {
+            transform->facingRight = false;  // Hit right wall, turn left
+            transform->position.x = rightBound;
         }
 
         // Keep boss constrained to movement area and on ground
-        boss->position.x = Clamp(boss->position.x, leftBound, rightBound);
-        boss->position.y = map->height * map->tile_height - bossHeight;  // Ground level
+        transform->position.x = Clamp(transform->position.x, leftBound, rightBound);
+        transform->position.y = GetLevelPixelHeight(level) - bossHeight;  // Ground level
     }
 
-    // UPDATE BOSS ANIMATION FRAMES
-    boss->frameCounter += delta;
-    // Advance to next frame when frame timer expires
-    if (boss->frameCounter >= boss->frameTime) {
-        boss->frameCounter = 0;
-        boss->frame++;
-        // Loop animation through 6 frames (0-5)
-        if (boss->frame >= 6) boss->frame = 0;
-    }
+    // UPDATE BOSS ANIMATION FRAMES (the clip loops)
+    AdvanceAnimation(&boss->move, delta);
 }
 
-// Draw the boss with appropriate animation state
-void DrawBoss(Boss *boss, Texture2D deathTex) {
-    float scale = 1.8f;  // Scale factor for boss size
+// Boss system - every AI_BOSS entity; a dead one stops colliding
+void UpdateBosses(World *world, float delta, const Level *level, Rng *rng) {
+    ComponentSet *ais = &world->components[COMPONENT_AI];
+    for (int i = 0; i < ais->count; i++) {
+        Ai *ai = ComponentAt(ais, i);
+        if (ai->kind != AI_BOSS || ai->paused) continue;
+        int32_t slot = ais->slots[i];
+        Transform *transform = GetComponentOfSlot(world, slot, COMPONENT_TRANSFORM);
+        Health *health = GetComponentOfSlot(world, slot, COMPONENT_HEALTH);
+        Collider *collider = GetComponentOfSlot(world, slot, COMPONENT_COLLIDER);
+        Sprite *sprite = GetComponentOfSlot(world, slot, COMPONENT_SPRITE);
+        if (!transform || !health || !collider || !sprite) continue;
 
-    // DEATH ANIMATION: Draw death sequence when boss is defeated
-    if (boss->isDead) {
-        // Start death animation if it hasn't started yet
-        if (!boss->deathAnimPlaying && !boss->deathFinished) {
-            boss->deathAnimPlaying = true;
-            boss->deathFrame = 0;
-            boss->deathFrameCounter = 0;
-        }
-
-        // Play death animation frames
-        if (boss->deathAnimPlaying && !boss->deathFinished) {
-            // Death texture is a sprite sheet with 10 columns and 2 rows (20 total frames)
-            int cols = 10;
-            int rows = 2;
-            int frameWidth = deathTex.width / cols;
-            int frameHeight = deathTex.height / rows;
-
-            // Calculate current frame position in the sprite sheet
-            int currentRow = boss->deathFrame / cols;  // Which row (0 or 1)
-            int currentCol = boss->deathFrame % cols;  // Which column (0-9)
-
-            // Source rectangle - portion of texture to draw
-            Rectangle source = {
-                currentCol * frameWidth,    // X position in texture
-                currentRow * frameHeight,   // Y position in texture
-                frameWidth,                 // Width of frame
-                frameHeight                 // Height of frame
-            };
-            
-            // Destination rectangle - where to draw on screen
-            Rectangle dest = {
-                boss->position.x,           // X position on screen
-                boss->position.y,           // Y position on screen
-                frameWidth * scale,         // Scaled width
-                frameHeight * scale         // Scaled height
-            };
-
-            // Draw the current death animation frame
-            DrawTexturePro(deathTex, source, dest, (Vector2){0,0}, 0, WHITE);
-
-            // Advance to next frame based on time
-            boss->deathFrameCounter += GetFrameTime();
-            if (boss->deathFrameCounter >= boss->deathFrameTime) {
-                boss->deathFrameCounter = 0;
-                boss->deathFrame++;
-                
-                // Check if death animation is complete (played all 20 frames)
-                if (boss->deathFrame >= cols * rows) {
-                    boss->deathAnimPlaying = false;
-                    boss->deathFinished = true;  // Mark animation as complete
-                }
-            }
-        }
-        return;  // Don't draw normal boss when dead
+        update_boss(&ai->boss, transform, health, collider, delta, level, rng);
+        collider->enabled = !ai->boss.isDead;
+        sync_sprite(sprite, &ai->boss, transform);
     }
-
-    // NORMAL BOSS DRAWING: Draw living boss with current animation frame
-    
-    // Calculate frame dimensions (texture has 6 frames horizontally)
-    int frameWidth = boss->skillRight.width / 6;
-    int frameHeight = boss->skillRight.height;
-    
-    // Source rectangle - select current frame from sprite sheet
-    Rectangle source = { 
-        boss->frame * frameWidth,  // X position based on current frame
-        0,                         // Y position (top of texture)
-        frameWidth,                // Width of one frame
-        frameHeight                // Height of frame
-    };
-    
-    // Destination rectangle - where to draw on screen
-    Rectangle dest = { 
-        boss->position.x,          // X position on screen
-        boss->position.y,          // Y position on screen
-        frameWidth * scale,        // Scaled width
-        frameHeight * scale        // Scaled height
-    };
-
-    // Choose texture based on facing direction
-    Texture2D current = boss->facingRight ? boss->skillRight : boss->skillLeft;
-    
-    // Draw the boss with the selected texture and current animation frame
-    DrawTexturePro(current, source, dest, (Vector2){0,0}, 0, WHITE);
 }
-
-// Clean up boss resources - free loaded textures
-void CleanupBoss(Boss *boss) {
-    UnloadTexture(boss->skillRight);  // Free right-facing skill texture
-    UnloadTexture(boss->skillLeft);   // Free left-facing skill texture
-}
\ No newline at end of file
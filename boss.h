@@ -4,72 +4,32 @@
 // Include necessary libraries for boss functionality
 #include "raylib.h"      // Provides graphics, audio, and input functionality
 #include "raymath.h"     // Provides vector math utilities (Vector2 operations, etc.)
-#include "tmx.h"         // Provides tilemap loading and collision detection
-
-// Boss structure definition - contains all data needed for boss behavior and rendering
-typedef struct Boss {
-    // Position and spawning information
-    Vector2 position;        // Current world coordinates of the boss
-    Vector2 spawn;           // Original spawn location for resetting or reference
-    int health;              // Hit points - when <= 0, boss is defeated
-    float speed;             // Base movement speed of the boss
-    
-    // Animation system for normal boss movements/attacks
-    int frame;               // Current frame index in the animation sequence
-    float frameTime;         // Time accumulated for frame updates
-    float frameCounter;      // Counter to track when to advance to next frame
-    
-    // Attack skill textures (direction-specific)
-    Texture2D skillRight;    // Texture used for right-facing attacks or skills
-    Texture2D skillLeft;     // Texture used for left-facing attacks or skills
-    
-    // Battle phase management (for multi-phase boss fights)
-    int phase;               // Current phase of the boss fight (1, 2, 3, etc.)
-    bool facingRight;        // Direction the boss is facing (true=right, false=left)
-    
-    // Dash attack system
-    bool isDashing;          // Flag indicating if boss is currently performing a dash attack
-    float dashTimer;         // Tracks how long the dash has been active
-    float dashCooldown;      // Time required before boss can dash again
-    float dashSpeed;         // Special speed used during dash attacks (usually faster)
-    
-    // Zigzag movement pattern (for evasive or unpredictable movement)
-    float zigzagTimer;       // Timer for controlling zigzag oscillation
-    float zigzagAmplitude;   // How wide the zigzag movement swings (left-right distance)
-    float zigzagFrequency;   // How quickly the zigzag pattern oscillates
-    
-    // Teleportation ability
-    float teleportTimer;     // Timer tracking when to teleport next
-    float teleportCooldown;  // Delay between teleportation abilities
-    
-    // Special state flags
-    bool isFlying;           // Indicates if boss is in flying mode (different movement rules)
-    bool isDead;             // Flag set when boss health reaches zero
-    
-    // Death animation system (plays when boss is defeated)
-    bool deathAnimPlaying;   // Indicates if death animation is currently active
-    int deathFrame;          // Current frame in the death animation sequence
-    float deathFrameCounter; // Timer for death animation frame progression
-    float deathFrameTime;    // Duration each death animation frame should display
-    bool deathFinished;      // Flag set when death animation completes
-} Boss;
+#include "level.h"       // Level size for ground and bounds
+#include "atlas.h"       // Sprite frames from the shared atlas
+#include "ecs.h"         // Entities and components
+#include "rng.h"         // Seeded randomness (teleports)
+
+// Boss sprite constants
+#define BOSS_SCALE 1.8f      // Draw/collision scale applied to the boss sprite
+#define BOSS_ZIGZAG_STEP_RATE 60.0f // The zigzag offsets were tuned as per-frame steps at 60 FPS
+#define BOSS_DEATH_BURST 80         // Particles thrown off the moment the boss dies
+#define BOSS_DEATH_PARTICLE_RATE 150.0f // Particles per second while the death animation plays
+
+/*
+    The boss is an entity (see ecs.h):
+        -Transform, Collider (off once dead), Health
+        -Sprite (movement frames, then the death animation with particles over it)
+        -Ai of kind AI_BOSS (phases, dash / zigzag / teleport, death animation)
+*/
 
 // Function declarations:
 
-// Initializes boss with starting values and loads resources
-// Parameters: boss pointer, starting position, and map for collision data
-void InitBoss(Boss *boss, Vector2 position, tmx_map *map);
-
-// Updates boss logic each frame including AI, movement, attacks, and state changes
-// Parameters: boss pointer, time since last frame, map for collision detection
-void UpdateBoss(Boss *boss, float delta, tmx_map *map);
-
-// Renders the boss to the screen with appropriate animation state
-// Parameters: boss pointer, texture to use for death animation
-void DrawBoss(Boss *boss, Texture2D deathTex);
+// Creates a boss entity with starting values
+// Parameters: world, starting position
+EntityHandle SpawnBoss(World *world, Vector2 position);
 
-// Cleans up and frees all resources allocated for the boss
-// Parameters: boss pointer to clean up
-void CleanupBoss(Boss *boss);
+// Boss system - AI, movement, attacks, state changes and the death animation of every boss, one tick
+// Parameters: world, time since last tick, level for ground height, the game's random generator
+void UpdateBosses(World *world, float delta, const Level *level, Rng *rng);
 
 #endif
\ No newline at end of file
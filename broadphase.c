@@ -0,0 +1,152 @@
+#include "broadphase.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// Grow an array so it can hold at least `needed` items (false if out of memory - the old array is kept)
+static bool GrowArray(void **data, int *capacity, int needed, size_t itemSize) {
+    if (needed <= *capacity) return true;
+    int newCapacity = *capacity ? *capacity : 64;
+    while (newCapacity < needed) newCapacity *= 2;
+    void *grown = realloc(*data, (size_t)newCapacity * itemSize);
+    if (!grown) return false;
+    *data = grown;
+    *capacity = newCapacity;
+    return true;
+}
+
+// Grow entries and their bucket-sorted copy together, so sorting never has to allocate
+static bool GrowEntries(Broadphase *bp, int needed) {
+    int capacity = bp->entryCapacity;
+    int sortedCapacity = bp->entryCapacity;
+    if (!GrowArray((void **)&bp->entries, &capacity, needed, sizeof(CellEntry)) ||
+        !GrowArray((void **)&bp->sorted, &sortedCapacity, needed, sizeof(CellEntry))) return false;
+    bp->entryCapacity = capacity;
+    return true;
+}
+
+// Hash cell coordinates into a bucket (bucketCount is a power of two)
+static int HashCell(int cx, int cy, int bucketCount) {
+    unsigned int h = ((unsigned int)cx * 73856093u) ^ ((unsigned int)cy * 19349663u);
+    return (int)(h & (unsigned int)(bucketCount - 1));
+}
+
+// Initialize an empty broadphase
+void InitBroadphase(Broadphase *bp, float cellSize) {
+    memset(bp, 0, sizeof(*bp));
+    bp->cellSize = cellSize;
+}
+
+// Drop all bodies and pairs, keeping the allocated storage for the next tick
+void ClearBroadphase(Broadphase *bp) {
+    bp->bodyCount = 0;
+    bp->entryCount = 0;
+    bp->pairCount = 0;
+}
+
+// Register a body for this tick and add one entry per covered cell (-1 if out of memory)
+int AddBody(Broadphase *bp, Rectangle aabb, unsigned int kind, unsigned int mask, int index) {
+    int cx0 = (int)floorf(aabb.x / bp->cellSize);
+    int cy0 = (int)floorf(aabb.y / bp->cellSize);
+    int cx1 = (int)floorf((aabb.x + aabb.width) / bp->cellSize);
+    int cy1 = (int)floorf((aabb.y + aabb.height) / bp->cellSize);
+
+    int cells = (cx1 - cx0 + 1) * (cy1 - cy0 + 1);
+    if (!GrowArray((void **)&bp->bodies, &bp->bodyCapacity, bp->bodyCount + 1, sizeof(Body)) ||
+        !GrowEntries(bp, bp->entryCount + cells)) {
+        TraceLog(LOG_WARNING, "BROADPHASE: Out of memory, body %d dropped", index);
+        return -1;
+    }
+    int id = bp->bodyCount++;
+    bp->bodies[id] = (Body){ aabb, kind, mask, index, cx0, cy0 };
+
+    for (int cy = cy0; cy <= cy1; cy++) {
+        for (int cx = cx0; cx <= cx1; cx++) {
+            bp->entries[bp->entryCount++] = (CellEntry){ cx, cy, id };
+        }
+    }
+    return id;
+}
+
+/*
+    Collect candidate pairs:
+        -counting sort of all entries into hash buckets (no per-tick allocation once warmed up)
+        -inside a bucket, only entries of the same cell are paired
+        -a pair is reported only from the first cell both bodies cover, so it is never reported twice
+        -kind/mask filtering skips pairs nobody cares about (projectile vs projectile)
+*/
+void FindBroadphasePairs(Broadphase *bp) {
+    bp->pairCount = 0;
+    if (bp->entryCount == 0) return;
+
+    // Size the table to about twice the entry count (power of two)
+    int bucketCount = 64;
+    while (bucketCount < bp->entryCount * 2) bucketCount *= 2;
+    if (bucketCount > bp->bucketCapacity) {
+        int *buckets = realloc(bp->buckets, (size_t)(bucketCount + 1) * sizeof(int));
+        if (!buckets) {
+            TraceLog(LOG_WARNING, "BROADPHASE: Out of memory, no pairs this tick");
+            return;
+        }
+        bp->buckets = buckets;
+        bp->bucketCapacity = bucketCount;
+    }
+    bp->bucketCount = bucketCount;
+
+    // Count entries per bucket, then turn counts into start offsets
+    memset(bp->buckets, 0, (size_t)(bucketCount + 1) * sizeof(int));
+    for (int i = 0; i < bp->entryCount; i++) {
+        bp->buckets[HashCell(bp->entries[i].cellX, bp->entries[i].cellY, bucketCount) + 1]++;
+    }
+    for (int b = 0; b < bucketCount; b++) {
+        bp->buckets[b + 1] += bp->buckets[b];
+    }
+
+    // Scatter entries into their buckets (buckets[b] is used as the write cursor)
+    for (int i = 0; i < bp->entryCount; i++) {
+        int b = HashCell(bp->entries[i].cellX, bp->entries[i].cellY, bucketCount);
+        bp->sorted[bp->buckets[b]++] = bp->entries[i];
+    }
+    // Cursors now point at the end of each bucket - shift back to start offsets
+    for (int b = bucketCount; b > 0; b--) {
+        bp->buckets[b] = bp->buckets[b - 1];
+    }
+    bp->buckets[0] = 0;
+
+    // Pair up bodies sharing a cell
+    for (int b = 0; b < bucketCount; b++) {
+        int start = bp->buckets[b];
+        int end = bp->buckets[b + 1];
+        for (int i = start; i < end; i++) {
+            CellEntry *ei = &bp->sorted[i];
+            Body *bi = &bp->bodies[ei->body];
+            for (int j = i + 1; j < end; j++) {
+                CellEntry *ej = &bp->sorted[j];
+                if (ei->cellX != ej->cellX || ei->cellY != ej->cellY) continue; // Hash collision
+                Body *bj = &bp->bodies[ej->body];
+                if (!(bi->mask & bj->kind) && !(bj->mask & bi->kind)) continue;  // Not interested
+
+                // Report only from the first shared cell
+                int firstX = bi->cellX > bj->cellX ? bi->cellX : bj->cellX;
+                int firstY = bi->cellY > bj->cellY ? bi->cellY : bj->cellY;
+                if (firstX != ei->cellX || firstY != ei->cellY) continue;
+
+                if (!GrowArray((void **)&bp->pairs, &bp->pairCapacity, bp->pairCount + 1, sizeof(BodyPair))) {
+                    TraceLog(LOG_WARNING, "BROADPHASE: Out of memory, pairs past %d dropped", bp->pairCount);
+                    return;
+                }
+                bp->pairs[bp->pairCount++] = (BodyPair){ ei->body, ej->body };
+            }
+        }
+    }
+}
+
+// Release all broadphase storage
+void FreeBroadphase(Broadphase *bp) {
+    free(bp->bodies);
+    free(bp->entries);
+    free(bp->sorted);
+    free(bp->buckets);
+    free(bp->pairs);
+    memset(bp, 0, sizeof(*bp));
+}
@@ -0,0 +1,60 @@
+#ifndef BROADPHASE_H
+#define BROADPHASE_H
+
+// Include necessary libraries
+#include "raylib.h"  // Rectangle type for body bounds
+
+// Broadphase constants
+#define BROADPHASE_CELL_SIZE 64.0f  // Spatial hash cell size in pixels (about one character wide)
+
+// Body kinds - used as bits so a body can list the kinds it interacts with
+#define BODY_PLAYER     (1u << 0)
+#define BODY_BOSS       (1u << 1)
+#define BODY_PROJECTILE (1u << 2)
+
+// Body structure - one dynamic object registered for this tick
+typedef struct Body {
+    Rectangle aabb;      // World-space bounds
+    unsigned int kind;   // BODY_* bit of this body
+    unsigned int mask;   // BODY_* bits this body wants pairs with
+    int index;           // Index of the object in its owning system (projectile slot, etc.)
+    int cellX, cellY;    // First cell covered (used to report each pair once)
+} Body;
+
+// Cell entry - one body inside one cell of the hash
+typedef struct CellEntry {
+    int cellX, cellY;    // Cell coordinates
+    int body;            // Index into the body array
+} CellEntry;
+
+// Candidate pair of bodies that share a cell (indices into the body array)
+typedef struct BodyPair {
+    int a, b;
+} BodyPair;
+
+// Broadphase structure - uniform grid spatial hash rebuilt every tick
+typedef struct Broadphase {
+    float cellSize;                  // Cell size in pixels
+
+    Body *bodies;                    // Registered bodies
+    int bodyCount, bodyCapacity;
+
+    CellEntry *entries;              // Body/cell entries in registration order
+    CellEntry *sorted;               // Entries grouped by hash bucket
+    int entryCount, entryCapacity;   // Capacity of entries and sorted (they grow together)
+
+    int *buckets;                    // Bucket start offsets into sorted (bucketCount + 1)
+    int bucketCount, bucketCapacity;
+
+    BodyPair *pairs;                 // Candidate pairs found by the last FindBroadphasePairs
+    int pairCount, pairCapacity;
+} Broadphase;
+
+// Function declarations - broadphase management
+void InitBroadphase(Broadphase *bp, float cellSize);      // Set up an empty broadphase
+void ClearBroadphase(Broadphase *bp);                     // Drop all bodies (start of a tick)
+int AddBody(Broadphase *bp, Rectangle aabb, unsigned int kind, unsigned int mask, int index); // Register a body, returns its id (-1 if out of memory)
+void FindBroadphasePairs(Broadphase *bp);                 // Hash all bodies and collect candidate pairs
+void FreeBroadphase(Broadphase *bp);                      // Release all storage
+
+#endif
@@ -1,282 +1,215 @@
 #include "character.h"
 #include "projectile.h"
+#include "broadphase.h"
+#include "raymath.h"
 #include <stdlib.h>
-#include <string.h>
 
 #define SHOOT_COOLDOWN 0.5f  // Time between shots in seconds
-
-// Helper function to check if two rectangles intersect
-static bool RectIntersects(Rectangle a, Rectangle b) {
-    return !(a.x + a.width <= b.x || b.x + b.width <= a.x ||
-             a.y + a.height <= b.y || b.y + b.height <= a.y);
-}
-
-// Helper function to identify which tile layers are collidable
-static bool IsCollidableTileLayer(const char *name) {
-    return (strcmp(name, "platform") == 0 ||
-            strcmp(name, "bridge") == 0 ||
-            strcmp(name, "uw_plant") == 0);
+#define MAX_SLIDE_ITERATIONS 3 // Sweeps per update (one per contact face + the final free move)
+#define PLAYER_HEALTH 2000
+
+// Player clips from the registry (looked up once, at the first spawn)
+static int idleClip = -1, runClip = -1, jumpClip = -1;
+
+// Point the sprite at the current animation frame (flipped when facing left)
+static void sync_sprite(Sprite *sprite, const PlayerAi *player, const Transform *transform) {
+    const AnimationClip *clip = GetAnimationClip(player->animator.clip);
+    if (clip) sprite->sheet = clip->sheet;
+    sprite->frame = GetAnimationSpriteFrame(&player->animator);
+    sprite->flipX = !transform->facingRight;
 }
 
-// Check for collisions with tiles in the map
-static Rectangle* FindTileCollision(tmx_map *map, Rectangle char_rect) {
-    tmx_layer *layer = map->ly_head;
-    // Iterate through all layers in the map
-    while (layer) {
-        // Check if layer is visible and is a tile layer with collidable name
-        if (layer->visible && layer->type == L_LAYER && IsCollidableTileLayer(layer->name)) {
-            // Scan through all tiles in this layer
-            for (int i = 0; i < map->height; i++) {
-                for (int j = 0; j < map->width; j++) {
-                    // Get tile ID (remove flip flags)
-                    unsigned int gid = (layer->content.gids[(i*map->width)+j]) & TMX_FLIP_BITS_REMOVAL;
-                    if (gid) { // If tile exists at this position
-                        // Create rectangle for this tile
-                        Rectangle tileRect = {
-                            j * map->tile_width,
-                            i * map->tile_height,
-                            (float)map->tile_width,
-                            (float)map->tile_height
-                        };
-                        // Check collision with character
-                        if (RectIntersects(char_rect, tileRect)) {
-                            Rectangle *hit = malloc(sizeof(Rectangle));
-                            *hit = tileRect;
-                            return hit; // Return colliding tile
-                        }
-                    }
-                }
-            }
-        }
-        layer = layer->next;
+// Create the player entity with all its components
+EntityHandle SpawnPlayer(World *world, Vector2 position, float tileHeight) {
+    EntityHandle player = CreateEntity(world);
+    if (idleClip < 0) {
+        idleClip = FindAnimationClip("player_idle");
+        runClip = FindAnimationClip("player_run");
+        jumpClip = FindAnimationClip("player_jump");
     }
-    return NULL; // No collision found
-}
 
-// Initialize the character animation and state
-void InitAnimation(Animation* anim, float tile_height) {
-    // Load character sprite sheet
-    anim->spriteSheet = LoadTexture("main_character.png");
-    anim->position = (Vector2){0, 0};
-    anim->facingRight = true;
+    Transform *transform = AddComponent(world, player, COMPONENT_TRANSFORM);
+    transform->position = position;
+    transform->previousPosition = position;
+    transform->facingRight = true;
     // Scale character relative to tile height for consistent sizing
-    anim->scale = (3.0f * tile_height) / FRAME_HEIGHT;
-    anim->health = 2000;
-    anim->isPaused = false;
-
-    // Define number of frames for each animation row
-    int frameCounts[] = {4, 6, 10, 9, 10, 10, 7, 5};
-    // Set up frame rectangles for sprite sheet
-    for (int row = 0; row < NUM_ROWS; row++) {
-        anim->frameCount[row] = frameCounts[row];
-        for (int col = 0; col < frameCounts[row]; col++) {
-            anim->frames[row][col] = (Rectangle){
-                col * FRAME_WIDTH, row * FRAME_HEIGHT,
-                FRAME_WIDTH, FRAME_HEIGHT
-            };
-        }
-    }
-    
-    // Initialize animation state
-    anim->currentRow = 0;
-    anim->currentFrame = 0;
-    anim->frameTimer = 0.0f;
-    anim->isLooping = true;
-    anim->isPlayingOneShot = false;
-    anim->velocity = (Vector2){0, 0};
-    anim->grounded = false;
+    transform->scale = (3.0f * tileHeight) / FRAME_HEIGHT;
+
+    Velocity *velocity = AddComponent(world, player, COMPONENT_VELOCITY);
+    velocity->value = (Vector2){0, 0};
+    velocity->grounded = false;
+
+    Collider *collider = AddComponent(world, player, COMPONENT_COLLIDER);
+    collider->size = (Vector2){FRAME_WIDTH * transform->scale, FRAME_HEIGHT * transform->scale};
+    collider->kind = BODY_PLAYER;
+    collider->mask = BODY_BOSS;
+    collider->enabled = true;
+
+    Health *health = AddComponent(world, player, COMPONENT_HEALTH);
+    health->current = PLAYER_HEALTH;
+    health->max = PLAYER_HEALTH;
+    health->barColor = BLANK;  // Green / yellow / red
+
+    // Character frames from the sprite atlas (the clips pick which)
+    Sprite *sprite = AddComponent(world, player, COMPONENT_SPRITE);
+    sprite->sheet = -1;
+    sprite->size = (Vector2){FRAME_WIDTH, FRAME_HEIGHT};
+    sprite->depth = 0;
+    sprite->visible = true;
+
+    // Idle animation, looping
+    Ai *ai = AddComponent(world, player, COMPONENT_AI);
+    ai->kind = AI_PLAYER;
+    ai->paused = false;
+    ai->player.animator = StartAnimation(idleClip);
+    ai->player.shootTimer = 0.0f;
+    sync_sprite(sprite, &ai->player, transform);
+    return player;
 }
 
-// Update animation frames based on elapsed time
-void UpdateAnimation(Animation* anim, float delta) {
-    anim->frameTimer += delta;
-    // Advance frame every 0.1 seconds (10 FPS animation)
-    if (anim->frameTimer >= 0.1f) {
-        anim->frameTimer = 0.0f;
-        anim->currentFrame++;
-        
-        // Handle end of animation sequence
-        if (anim->currentFrame >= anim->frameCount[anim->currentRow]) {
-            if (anim->isLooping) {
-                // Loop back to first frame
-                anim->currentFrame = 0;
-            } else {
-                // Stop at last frame for one-shot animations
-                anim->currentFrame = anim->frameCount[anim->currentRow] - 1;
-                anim->isPlayingOneShot = false;
-                anim->isLooping = true;
-                // Return to idle animation
-                anim->currentRow = 0;
-                anim->currentFrame = 0;
-            }
-        }
-    }
-}
+// One player tick - handles input, physics, and collisions
+static void update_player(Ai *ai, Transform *transform, Velocity *velocity, Health *health,
+                          const Collider *collider, float delta, const CollisionGrid *grid, CharacterInput input) {
+    PlayerAi *player = &ai->player;
+    transform->previousPosition = transform->position;
 
-// Play a specific animation sequence
-void PlayAnimation(Animation* anim, int row, bool loop) {
-    // Don't interrupt one-shot animations
-    if (anim->isPlayingOneShot) return;
-    
-    // Only change if different animation or switching from one-shot to loop
-    if (anim->currentRow != row || !anim->isLooping) {
-        anim->currentRow = row;
-        anim->currentFrame = 0;
-        anim->isLooping = loop;
-        anim->isPlayingOneShot = !loop; // Mark as one-shot if not looping
-    }
-}
-
-// Draw the character to the screen
-void DrawAnimation(Animation* anim) {
-    // Ensure frame index is valid
-    int frame = anim->currentFrame;
-    if (frame >= anim->frameCount[anim->currentRow]) {
-        frame = anim->frameCount[anim->currentRow] - 1;
-    }
-    
-    // Set up source and destination rectangles
-    Rectangle src = anim->frames[anim->currentRow][frame];
-    Rectangle dest = {
-        anim->position.x,
-        anim->position.y,
-        FRAME_WIDTH * anim->scale,
-        FRAME_HEIGHT * anim->scale
-    };
-    Vector2 origin = {0, 0};
-    
-    // Flip sprite if facing left
-    if (!anim->facingRight) src.width = -src.width;
-    
-    DrawTexturePro(anim->spriteSheet, src, dest, origin, 0.0f, WHITE);
-}
-
-// Main character update function - handles input, physics, and collisions
-void UpdateCharacter(Animation* anim, float delta, tmx_map *map, float *shootTimer) {
     // Skip update if character is paused (game over, etc.)
-    if (anim->isPaused) {
-        anim->velocity.x = 0;
+    if (ai->paused) {
+        velocity->value.x = 0;
         return;
     }
-    
-    // Handle animation based on input and state
-    if (!anim->isPlayingOneShot) {
-        if (IsKeyDown(KEY_A) || IsKeyDown(KEY_D)) 
-            PlayAnimation(anim, 1, true); // Run animation
-        else if (IsKeyPressed(KEY_SPACE) && anim->grounded) 
-            PlayAnimation(anim, 2, false); // Jump animation (one-shot)
-        else if (anim->currentRow != 0) 
-            PlayAnimation(anim, 0, true); // Idle animation
+
+    // Handle animation based on input and state (a one-shot clip plays out first)
+    if (!IsAnimationOneShot(&player->animator)) {
+        if (input.left || input.right)
+            PlayAnimation(&player->animator, runClip);  // Run animation
+        else if (input.jump && velocity->grounded)
+            PlayAnimation(&player->animator, jumpClip); // Jump animation (back to idle when done)
+        else
+            PlayAnimation(&player->animator, idleClip); // Idle animation
     }
 
     // Handle horizontal movement input
     float move_x = 0.0f;
-    if (IsKeyDown(KEY_A)) { 
-        anim->facingRight = false; 
-        move_x -= MOVE_SPEED; 
+    if (input.left) {
+        transform->facingRight = false;
+        move_x -= MOVE_SPEED;
     }
-    if (IsKeyDown(KEY_D)) { 
-        anim->facingRight = true; 
-        move_x += MOVE_SPEED; 
+    if (input.right) {
+        transform->facingRight = true;
+        move_x += MOVE_SPEED;
     }
 
     // Handle jumping
-    if (IsKeyPressed(KEY_SPACE) && anim->grounded) {
-        anim->velocity.y = JUMP_VELOCITY;
-        anim->grounded = false;
+    if (input.jump && velocity->grounded) {
+        velocity->value.y = JUMP_VELOCITY;
+        velocity->grounded = false;
     }
 
     // Handle shooting with cooldown
-    *shootTimer -= delta;
-    if (IsKeyPressed(KEY_E) && *shootTimer <= 0.0f) {
-        ShootProjectile(anim);
-        *shootTimer = SHOOT_COOLDOWN;
+    player->shootTimer -= delta;
+    if (input.shoot && player->shootTimer <= 0.0f) {
+        ShootProjectile(transform);
+        player->shootTimer = SHOOT_COOLDOWN;
     }
 
     // Apply gravity and clamp fall speed
-    anim->velocity.y += GRAVITY * delta;
-    if (anim->velocity.y > MAX_FALL_SPEED) 
-        anim->velocity.y = MAX_FALL_SPEED;
-    anim->velocity.x = move_x;
-
-    // Calculate character collision rectangle
-    float char_w = FRAME_WIDTH * anim->scale;
-    float char_h = FRAME_HEIGHT * anim->scale;
-    Rectangle char_rect = {anim->position.x, anim->position.y, char_w, char_h};
-
-    // X-axis collision detection and response
-    Rectangle new_x = char_rect;
-    new_x.x += anim->velocity.x * delta;
-    Rectangle *coll_x = FindTileCollision(map, new_x);
-    if (!coll_x) {
-        // No collision - apply movement
-        anim->position.x = new_x.x;
-    } else {
-        // Collision detected - adjust position based on direction
-        if (anim->velocity.x > 0) 
-            anim->position.x = coll_x->x - char_w - 0.1f; // Stop at left side of tile
-        else 
-            anim->position.x = coll_x->x + coll_x->width + 0.1f; // Stop at right side of tile
-        anim->velocity.x = 0; // Stop horizontal movement
-        free(coll_x);
-    }
-    char_rect.x = anim->position.x; // Update rectangle position
+    velocity->value.y += GRAVITY * delta;
+    if (velocity->value.y > MAX_FALL_SPEED)
+        velocity->value.y = MAX_FALL_SPEED;
+    velocity->value.x = move_x;
+
+    // Character collision rectangle
+    float char_w = collider->size.x;
+    float char_h = collider->size.y;
+    Rectangle char_rect = GetColliderRect(transform, collider);
+
+    // Swept collision: move along the velocity and slide along any tile face that is hit
+    // (the sweep visits every tile crossed, so long frames cannot tunnel through thin platforms)
+    Vector2 motion = { velocity->value.x * delta, velocity->value.y * delta };
+    velocity->grounded = false;
+    for (int i = 0; i < MAX_SLIDE_ITERATIONS && (motion.x != 0 || motion.y != 0); i++) {
+        SweepHit hit = SweepCollisionGrid(grid, char_rect, motion);
+        if (!hit.hit) {
+            // No collision - apply the remaining movement
+            char_rect.x += motion.x;
+            char_rect.y += motion.y;
+            break;
+        }
 
-    // Y-axis collision detection and response
-    Rectangle new_y = char_rect;
-    new_y.y += anim->velocity.y * delta;
-    Rectangle *coll_y = FindTileCollision(map, new_y);
-    if (!coll_y) {
-        // No collision - apply movement
-        anim->position.y = new_y.y;
-        anim->grounded = false;
-    } else {
-        if (anim->velocity.y > 0) {
+        // Move up to the contact point
+        char_rect.x += motion.x * hit.time;
+        char_rect.y += motion.y * hit.time;
+        motion.x *= 1.0f - hit.time;
+        motion.y *= 1.0f - hit.time;
+
+        if (hit.normal.x != 0) {
+            // Wall - snap flush against the tile face and stop horizontal movement
+            char_rect.x = (hit.normal.x < 0) ? hit.tile.x - char_w : hit.tile.x + hit.tile.width;
+            velocity->value.x = 0;
+            motion.x = 0;
+        } else if (hit.normal.y < 0) {
             // Landing on ground
-            anim->position.y = coll_y->y - char_h;
-            anim->grounded = true;
+            char_rect.y = hit.tile.y - char_h;
+            velocity->grounded = true;
+            velocity->value.y = 0;
+            motion.y = 0;
         } else {
             // Hitting ceiling
-            anim->position.y = coll_y->y + coll_y->height + 0.1f;
-            anim->velocity.y = 0;
+            char_rect.y = hit.tile.y + hit.tile.height;
+            velocity->value.y = 0;
+            motion.y = 0;
         }
-        free(coll_y);
     }
+    transform->position.x = char_rect.x;
+    transform->position.y = char_rect.y;
 
     // Keep character within map boundaries
-    float map_w = map->width * map->tile_width;
-    float map_h = map->height * map->tile_height;
-    if (anim->position.x < 0) anim->position.x = 0;
-    if (anim->position.x > map_w - char_w) anim->position.x = map_w - char_w;
+    float map_w = grid->width * grid->tileWidth;
+    float map_h = grid->height * grid->tileHeight;
+    if (transform->position.x < 0) transform->position.x = 0;
+    if (transform->position.x > map_w - char_w) transform->position.x = map_w - char_w;
 
-    if (anim->position.y < 0) {
-        anim->position.y = 0;
-        anim->velocity.y = 0;
+    if (transform->position.y < 0) {
+        transform->position.y = 0;
+        velocity->value.y = 0;
     }
-    if (anim->position.y > map_h - char_h) {
-        anim->position.y = map_h - char_h;
-        anim->grounded = true;
-        anim->velocity.y = 0;
+    if (transform->position.y > map_h - char_h) {
+        transform->position.y = map_h - char_h;
+        velocity->grounded = true;
+        velocity->value.y = 0;
     }
 
     // Check if character is standing on solid ground (prevent falling through)
-    if (anim->grounded) {
-        Rectangle feet_rect = {anim->position.x, anim->position.y + char_h - 1, char_w, 2};
-        Rectangle *coll_feet = FindTileCollision(map, feet_rect);
-        if (!coll_feet) {
+    if (velocity->grounded) {
+        Rectangle feet_rect = {transform->position.x, transform->position.y + char_h - 1, char_w, 2};
+        TileHit coll_feet = FindTileCollision(grid, feet_rect);
+        if (!coll_feet.hit) {
             // Character is floating - game over
-            anim->health = 0;
-            anim->isPaused = true;
-        } else {
-            free(coll_feet);
+            health->current = 0;
+            ai->paused = true;
         }
     }
 
     // Update animation frames
-    UpdateAnimation(anim, delta);
+    AdvanceAnimation(&player->animator, delta);
 }
 
-// Clean up character resources
-void CleanupAnimation(Animation* anim) {
-    UnloadTexture(anim->spriteSheet);
-}
\ No newline at end of file
+// Player system - every AI_PLAYER entity takes the same controls
+void UpdatePlayers(World *world, float delta, const CollisionGrid *grid, CharacterInput input) {
+    ComponentSet *ais = &world->components[COMPONENT_AI];
+    for (int i = 0; i < ais->count; i++) {
+        Ai *ai = ComponentAt(ais, i);
+        if (ai->kind != AI_PLAYER) continue;
+        int32_t slot = ais->slots[i];
+        Transform *transform = GetComponentOfSlot(world, slot, COMPONENT_TRANSFORM);
+        Velocity *velocity = GetComponentOfSlot(world, slot, COMPONENT_VELOCITY);
+        Health *health = GetComponentOfSlot(world, slot, COMPONENT_HEALTH);
+        Collider *collider = GetComponentOfSlot(world, slot, COMPONENT_COLLIDER);
+        Sprite *sprite = GetComponentOfSlot(world, slot, COMPONENT_SPRITE);
+        if (!transform || !velocity || !health || !collider || !sprite) continue;
+
+        update_player(ai, transform, velocity, health, collider, delta, grid, input);
+        sync_sprite(sprite, &ai->player, transform);
+    }
+}
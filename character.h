@@ -3,13 +3,13 @@
 
 // Include necessary libraries
 #include "raylib.h"  // Raylib graphics/audio/input library
-#include "tmx.h"     // TMX map loader for collision detection
+#include "collision.h" // Tile collision grid
+#include "atlas.h"     // Sprite frames from the shared atlas
+#include "ecs.h"       // Entities and components
 
 // Animation and character constants
 #define FRAME_WIDTH 50      // Width of each animation frame in pixels
 #define FRAME_HEIGHT 37     // Height of each animation frame in pixels
-#define NUM_ROWS 8          // Number of animation rows in the sprite sheet
-#define MAX_FRAMES 10       // Maximum number of frames per animation row
 
 // Physics and movement constants
 #define MOVE_SPEED 200.0f       // Character horizontal movement speed
@@ -17,34 +17,22 @@
 #define JUMP_VELOCITY -720.0f   // Initial upward velocity when jumping
 #define MAX_FALL_SPEED 1000.0f  // Maximum falling speed to prevent excessive velocity
 
-// Animation structure - holds all data for character animation and state
-typedef struct Animation {
-    // Sprite and animation data
-    Texture2D spriteSheet;                  // Loaded sprite sheet texture
-    Rectangle frames[NUM_ROWS][MAX_FRAMES]; // Array of frame rectangles for each animation row
-    int currentRow;                         // Current animation row (type of animation)
-    int currentFrame;                       // Current frame within the row
-    int frameCount[NUM_ROWS];               // Number of frames in each row
-    float frameTimer;                       // Timer for frame updates
-    bool isLooping;                         // Whether animation should loop
-    bool isPlayingOneShot;                  // Whether playing a one-time animation
-    
-    // Character state and physics
-    Vector2 position;       // Current position in world coordinates
-    bool facingRight;       // Character facing direction (true = right, false = left)
-    float scale;           // Scale factor for drawing character
-    Vector2 velocity;      // Current velocity (x, y)
-    bool grounded;         // Whether character is touching the ground
-    int health;           // Character health points
-    bool isPaused;        // Whether character updates are paused (for game over states)
-} Animation;
+// Controls for one simulation tick - presses stay set until a tick has used them,
+// so a press is never lost in a frame that runs no tick (or seen twice in one that runs several)
+typedef struct CharacterInput {
+    bool left, right;      // Held
+    bool jump, shoot;      // Pressed since the last tick
+} CharacterInput;
 
-// Function declarations - character management
-void InitAnimation(Animation* anim, float tile_height);           // Initialize character with animation
-void UpdateCharacter(Animation* anim, float delta, tmx_map *map, float *shootTimer); // Update character logic
-void UpdateAnimation(Animation* anim, float delta);               // Update animation frames
-void PlayAnimation(Animation* anim, int row, bool loop);          // Play specific animation
-void DrawAnimation(Animation* anim);                              // Draw character to screen
-void CleanupAnimation(Animation* anim);                           // Clean up character resources
+/*
+    The player is an entity (see ecs.h):
+        -Transform, Velocity, Collider, Health
+        -Sprite (frames of the clip playing)
+        -Ai of kind AI_PLAYER (animator and shooting cooldown)
+*/
+
+// Function declarations - player entities
+EntityHandle SpawnPlayer(World *world, Vector2 position, float tileHeight);  // Create the player at position (sized from the tile height)
+void UpdatePlayers(World *world, float delta, const CollisionGrid *grid, CharacterInput input); // Player system - input, physics, tile collisions, animation
 
 #endif
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include "collision.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+// Contact skin in pixels - overlaps smaller than this are treated as touching,
+// so float error after snapping to a tile face never lets a box slip into it
+#define SWEEP_SKIN 0.01f
+
+// Mark a single tile as solid in the bitmap
+static void SetSolidTile(CollisionGrid *grid, int tx, int ty) {
+    grid->bits[ty * grid->wordsPerRow + (tx >> 5)] |= 1u << (tx & 31);
+}
+
+// Build the collision grid from every visible collidable layer of the level
+void BuildCollisionGrid(CollisionGrid *grid, const Level *level) {
+    grid->width = level->header->width;
+    grid->height = level->header->height;
+    grid->tileWidth = level->header->tileWidth;
+    grid->tileHeight = level->header->tileHeight;
+    grid->wordsPerRow = (grid->width + 31) / 32;
+    grid->bits = calloc((size_t)grid->wordsPerRow * grid->height, sizeof(uint32_t));
+    grid->ownsBits = true;
+    if (!grid->bits) return;  // Out of memory - the caller finds bits NULL
+
+    // Merge all collidable layers into one bitmap - layer walk happens only here
+    uint32_t required = LEVEL_LAYER_VISIBLE | LEVEL_LAYER_COLLIDABLE;
+    for (int l = 0; l < level->header->layerCount; l++) {
+        if ((level->layers[l].flags & required) != required) continue;
+        for (int c = 0; c < level->header->chunkCount; c++) {
+            const uint32_t *gids = GetLevelChunkGids(level, c, l);
+            for (int i = 0; i < grid->height; i++) {
+                for (int j = 0; j < LEVEL_CHUNK_TILES && c * LEVEL_CHUNK_TILES + j < grid->width; j++) {
+                    // Get tile ID (remove flip flags)
+                    unsigned int gid = gids[i * LEVEL_CHUNK_TILES + j] & TMX_FLIP_BITS_REMOVAL;
+                    if (gid) SetSolidTile(grid, c * LEVEL_CHUNK_TILES + j, i);
+                }
+            }
+        }
+    }
+}
+
+// Borrow the bitmap MapCompiler already merged - nothing to build or free
+void UseLevelCollision(CollisionGrid *grid, const Level *level) {
+    grid->width = level->header->width;
+    grid->height = level->header->height;
+    grid->tileWidth = level->header->tileWidth;
+    grid->tileHeight = level->header->tileHeight;
+    grid->wordsPerRow = level->header->collisionWordsPerRow;
+    grid->bits = (uint32_t *)level->collisionBits;
+    grid->ownsBits = false;
+}
+
+// Check whether a tile is solid - anything outside the map counts as empty
+bool IsSolidTile(const CollisionGrid *grid, int tx, int ty) {
+    if (tx < 0 || ty < 0 || tx >= grid->width || ty >= grid->height) return false;
+    return (grid->bits[ty * grid->wordsPerRow + (tx >> 5)] >> (tx & 31)) & 1u;
+}
+
+// Find the first solid tile (row-major) overlapping the rectangle
+// Only the tiles under the rectangle are visited, so the cost follows the rectangle size
+TileHit FindTileCollision(const CollisionGrid *grid, Rectangle rect) {
+    TileHit result = { false, { 0, 0, 0, 0 } };
+
+    // Tile range covered by the rectangle (touching edges do not count as overlap)
+    int tx0 = (int)floorf(rect.x / grid->tileWidth);
+    int ty0 = (int)floorf(rect.y / grid->tileHeight);
+    int tx1 = (int)ceilf((rect.x + rect.width) / grid->tileWidth) - 1;
+    int ty1 = (int)ceilf((rect.y + rect.height) / grid->tileHeight) - 1;
+
+    // Clamp to the map
+    if (tx0 < 0) tx0 = 0;
+    if (ty0 < 0) ty0 = 0;
+    if (tx1 >= grid->width) tx1 = grid->width - 1;
+    if (ty1 >= grid->height) ty1 = grid->height - 1;
+
+    for (int ty = ty0; ty <= ty1; ty++) {
+        for (int tx = tx0; tx <= tx1; tx++) {
+            if (IsSolidTile(grid, tx, ty)) {
+                result.hit = true;
+                result.tile = (Rectangle){
+                    (float)(tx * grid->tileWidth),
+                    (float)(ty * grid->tileHeight),
+                    (float)grid->tileWidth,
+                    (float)grid->tileHeight
+                };
+                return result;
+            }
+        }
+    }
+    return result; // No collision found
+}
+
+// Tile range covered by [start, end) along one axis, ignoring overlaps thinner than the skin
+static void TileSpan(float start, float end, int tileSize, int count, int *first, int *last) {
+    *first = (int)floorf((start + SWEEP_SKIN) / tileSize);
+    *last = (int)ceilf((end - SWEEP_SKIN) / tileSize) - 1;
+    if (*first < 0) *first = 0;
+    if (*last >= count) *last = count - 1;
+}
+
+// Sign of a value (-1, 0 or 1)
+static float SignOf(float v) {
+    return (v > 0) ? 1.0f : (v < 0) ? -1.0f : 0.0f;
+}
+
+/*
+    Sweep a box through the grid and report the first solid tile it runs into.
+    The leading edges are walked tile by tile in time order (like a DDA line walk):
+        -every time the leading X edge enters a new column, that column is tested over the rows the box covers
+        -every time the leading Y edge enters a new row, that row is tested over the columns the box covers
+    Only tiles the box actually crosses are visited, so any motion length works without substepping.
+    Tiles the box already overlaps at the start are ignored.
+*/
+SweepHit SweepCollisionGrid(const CollisionGrid *grid, Rectangle box, Vector2 motion) {
+    SweepHit result = { false, 1.0f, { 0, 0 }, { 0, 0, 0, 0 } };
+    int tw = grid->tileWidth;
+    int th = grid->tileHeight;
+
+    // Next column the leading X edge enters, and the time it gets there
+    int stepX = (int)SignOf(motion.x);
+    int col = 0;
+    float tNextX = FLT_MAX, tDeltaX = FLT_MAX;
+    if (stepX > 0) {
+        float lead = box.x + box.width;
+        col = (int)ceilf((lead - SWEEP_SKIN) / tw);
+        tNextX = (col * tw - lead) / motion.x;
+        tDeltaX = tw / motion.x;
+    } else if (stepX < 0) {
+        float lead = box.x;
+        col = (int)floorf((lead + SWEEP_SKIN) / tw) - 1;
+        tNextX = ((col + 1) * tw - lead) / motion.x;
+        tDeltaX = -tw / motion.x;
+    }
+
+    // Next row the leading Y edge enters, and the time it gets there
+    int stepY = (int)SignOf(motion.y);
+    int row = 0;
+    float tNextY = FLT_MAX, tDeltaY = FLT_MAX;
+    if (stepY > 0) {
+        float lead = box.y + box.height;
+        row = (int)ceilf((lead - SWEEP_SKIN) / th);
+        tNextY = (row * th - lead) / motion.y;
+        tDeltaY = th / motion.y;
+    } else if (stepY < 0) {
+        float lead = box.y;
+        row = (int)floorf((lead + SWEEP_SKIN) / th) - 1;
+        tNextY = ((row + 1) * th - lead) / motion.y;
+        tDeltaY = -th / motion.y;
+    }
+
+    // Walk the crossing events in time order until the motion is used up
+    while (tNextX <= 1.0f || tNextY <= 1.0f) {
+        bool crossX = tNextX <= tNextY;
+        float t = crossX ? tNextX : tNextY;
+        if (t < 0) t = 0; // Box already touching the face
+
+        if (crossX) {
+            // Nothing solid past the map edge in the direction of travel
+            if ((col < 0 || col >= grid->width) && (stepX > 0) == (col >= grid->width)) {
+                tNextX = FLT_MAX;
+                continue;
+            }
+            // Rows covered at the moment of entry, nudged along Y so corner crossings are not missed
+            float y = box.y + motion.y * t + SignOf(motion.y) * SWEEP_SKIN * 2;
+            int r0, r1;
+            TileSpan(y, y + box.height, th, grid->height, &r0, &r1);
+            for (int r = r0; r <= r1; r++) {
+                if (IsSolidTile(grid, col, r)) {
+                    result.hit = true;
+                    result.time = t;
+                    result.normal = (Vector2){ (float)-stepX, 0 };
+                    result.tile = (Rectangle){ (float)(col * tw), (float)(r * th), (float)tw, (float)th };
+                    return result;
+                }
+            }
+            col += stepX;
+            tNextX += tDeltaX;
+        } else {
+            if ((row < 0 || row >= grid->height) && (stepY > 0) == (row >= grid->height)) {
+                tNextY = FLT_MAX;
+                continue;
+            }
+            // Columns covered at the moment of entry, nudged along X
+            float x = box.x + motion.x * t + SignOf(motion.x) * SWEEP_SKIN * 2;
+            int c0, c1;
+            TileSpan(x, x + box.width, tw, grid->width, &c0, &c1);
+            for (int c = c0; c <= c1; c++) {
+                if (IsSolidTile(grid, c, row)) {
+                    result.hit = true;
+                    result.time = t;
+                    result.normal = (Vector2){ 0, (float)-stepY };
+                    result.tile = (Rectangle){ (float)(c * tw), (float)(row * th), (float)tw, (float)th };
+                    return result;
+                }
+            }
+            row += stepY;
+            tNextY += tDeltaY;
+        }
+    }
+    return result; // Motion is free
+}
+
+// Release the collision bitmap
+void FreeCollisionGrid(CollisionGrid *grid) {
+    if (grid->ownsBits) free(grid->bits);
+    grid->bits = NULL;
+}
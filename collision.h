@@ -0,0 +1,43 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+// Include necessary libraries
+#include "raylib.h"  // Rectangle type used for queries
+#include "level.h"   // Level the grid is built from
+#include <stdint.h>
+
+// Collision grid - packed solid-tile bitmap merged from all collidable layers
+// Built once per map so queries only touch the tiles under the query rectangle
+typedef struct CollisionGrid {
+    int width;          // Grid width in tiles
+    int height;         // Grid height in tiles
+    int tileWidth;      // Width of one tile in pixels
+    int tileHeight;     // Height of one tile in pixels
+    int wordsPerRow;    // Number of 32-bit words per bitmap row
+    uint32_t *bits;     // Solid bitmap (1 bit per tile, row-major)
+    bool ownsBits;      // false when bits point into a compiled level
+} CollisionGrid;
+
+// Result of a tile collision query (returned by value, nothing to free)
+typedef struct TileHit {
+    bool hit;           // Whether a solid tile overlaps the query rectangle
+    Rectangle tile;     // World rectangle of the first overlapping solid tile
+} TileHit;
+
+// Result of sweeping a box through the grid
+typedef struct SweepHit {
+    bool hit;           // Whether the box hits a solid tile along the motion
+    float time;         // Time of impact as a fraction of the motion (0 - 1)
+    Vector2 normal;     // Contact normal of the tile face that was hit
+    Rectangle tile;     // World rectangle of the tile that was hit
+} SweepHit;
+
+// Function declarations - collision grid management
+void BuildCollisionGrid(CollisionGrid *grid, const Level *level);     // Merge collidable layers into a new bitmap (bits NULL if out of memory)
+void UseLevelCollision(CollisionGrid *grid, const Level *level);      // Use the level's precompiled bitmap in place
+bool IsSolidTile(const CollisionGrid *grid, int tx, int ty);          // Test a single tile (out of range = empty)
+TileHit FindTileCollision(const CollisionGrid *grid, Rectangle rect); // First solid tile overlapping rect
+SweepHit SweepCollisionGrid(const CollisionGrid *grid, Rectangle box, Vector2 motion); // First tile hit moving box by motion
+void FreeCollisionGrid(CollisionGrid *grid);                          // Release the bitmap (if owned)
+
+#endif
@@ -0,0 +1,204 @@
+#include "ecs.h"
+#include "raymath.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define COMPONENT_INITIAL_CAPACITY 16
+#define WORLD_INITIAL_ENTITIES 64
+
+// Bytes per component, by type
+static const size_t componentSizes[COMPONENT_TYPE_COUNT] = {
+    [COMPONENT_TRANSFORM] = sizeof(Transform),
+    [COMPONENT_VELOCITY] = sizeof(Velocity),
+    [COMPONENT_COLLIDER] = sizeof(Collider),
+    [COMPONENT_SPRITE] = sizeof(Sprite),
+    [COMPONENT_HEALTH] = sizeof(Health),
+    [COMPONENT_AI] = sizeof(Ai),
+};
+
+// Make room in the sparse table for slot (new entries are -1)
+static bool grow_sparse(ComponentSet *set, int32_t slot) {
+    if (slot < set->sparseCapacity) return true;
+    int capacity = set->sparseCapacity ? set->sparseCapacity : WORLD_INITIAL_ENTITIES;
+    while (capacity <= slot) capacity *= 2;
+    int32_t *sparse = realloc(set->sparse, capacity * sizeof(int32_t));
+    if (!sparse) return false;
+    for (int i = set->sparseCapacity; i < capacity; i++) sparse[i] = -1;
+    set->sparse = sparse;
+    set->sparseCapacity = capacity;
+    return true;
+}
+
+// Make room for count dense components
+static bool grow_dense(ComponentSet *set, int count) {
+    if (count <= set->capacity) return true;
+    int capacity = set->capacity ? set->capacity : COMPONENT_INITIAL_CAPACITY;
+    while (capacity < count) capacity *= 2;
+    unsigned char *data = realloc(set->data, capacity * set->size);
+    if (data) set->data = data;
+    int32_t *slots = realloc(set->slots, capacity * sizeof(int32_t));
+    if (slots) set->slots = slots;
+    if (!data || !slots) return false;
+    set->capacity = capacity;
+    return true;
+}
+
+// Dense index of slot's component (-1 = none)
+static int find_component(const ComponentSet *set, int32_t slot) {
+    return slot >= 0 && slot < set->sparseCapacity ? set->sparse[slot] : -1;
+}
+
+// Swap-remove the component at a dense index
+static void remove_at(ComponentSet *set, int index) {
+    int last = --set->count;
+    set->sparse[set->slots[index]] = -1;
+    if (index != last) {
+        memcpy(set->data + (size_t)index * set->size, set->data + (size_t)last * set->size, set->size);
+        set->slots[index] = set->slots[last];
+        set->sparse[set->slots[index]] = index;
+    }
+}
+
+bool InitWorld(World *world) {
+    memset(world, 0, sizeof(*world));
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        world->components[type].size = componentSizes[type];
+    }
+    return InitEntityPool(&world->entities, WORLD_INITIAL_ENTITIES);
+}
+
+void FreeWorld(World *world) {
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        ComponentSet *set = &world->components[type];
+        free(set->data);
+        free(set->slots);
+        free(set->sparse);
+    }
+    FreeEntityPool(&world->entities);
+    memset(world, 0, sizeof(*world));
+}
+
+EntityHandle CreateEntity(World *world) {
+    EntityHandle entity;
+    SpawnEntity(&world->entities, &entity);
+    return entity;
+}
+
+void DestroyEntity(World *world, EntityHandle entity) {
+    if (!IsEntityAlive(world, entity)) return;
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        ComponentSet *set = &world->components[type];
+        int index = find_component(set, entity.slot);
+        if (index >= 0) remove_at(set, index);
+    }
+    DespawnEntity(&world->entities, entity);
+}
+
+bool IsEntityAlive(const World *world, EntityHandle entity) {
+    return GetEntityIndex(&world->entities, entity) >= 0;
+}
+
+void *AddComponent(World *world, EntityHandle entity, ComponentType type) {
+    if (!IsEntityAlive(world, entity)) return NULL;
+    ComponentSet *set = &world->components[type];
+    int index = find_component(set, entity.slot);
+    if (index >= 0) return ComponentAt(set, index);
+
+    if (!grow_sparse(set, entity.slot) || !grow_dense(set, set->count + 1)) {
+        TraceLog(LOG_WARNING, "ECS: Out of memory adding a component");
+        return NULL;
+    }
+    index = set->count++;
+    set->slots[index] = entity.slot;
+    set->sparse[entity.slot] = index;
+    void *component = ComponentAt(set, index);
+    memset(component, 0, set->size);
+    return component;
+}
+
+void RemoveComponent(World *world, EntityHandle entity, ComponentType type) {
+    if (!IsEntityAlive(world, entity)) return;
+    ComponentSet *set = &world->components[type];
+    int index = find_component(set, entity.slot);
+    if (index >= 0) remove_at(set, index);
+}
+
+void *GetComponent(const World *world, EntityHandle entity, ComponentType type) {
+    if (!IsEntityAlive(world, entity)) return NULL;
+    return GetComponentOfSlot(world, entity.slot, type);
+}
+
+void *GetComponentOfSlot(const World *world, int32_t slot, ComponentType type) {
+    const ComponentSet *set = &world->components[type];
+    int index = find_component(set, slot);
+    return index >= 0 ? ComponentAt(set, index) : NULL;
+}
+
+// Entity tables, then each set's dense components and sparse table
+void SaveWorld(const World *world, Snapshot *snapshot) {
+    SaveEntityPool(&world->entities, snapshot);
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        const ComponentSet *set = &world->components[type];
+        WriteSnapshot(snapshot, &set->count, sizeof(set->count));
+        WriteSnapshot(snapshot, &set->sparseCapacity, sizeof(set->sparseCapacity));
+        WriteSnapshot(snapshot, set->data, (size_t)set->count * set->size);
+        WriteSnapshot(snapshot, set->slots, set->count * sizeof(int32_t));
+        WriteSnapshot(snapshot, set->sparse, set->sparseCapacity * sizeof(int32_t));
+    }
+}
+
+// Arrays only grow here - sparse entries past the saved table are set to -1
+bool LoadWorld(World *world, SnapshotReader *reader) {
+    if (!LoadEntityPool(&world->entities, reader)) return false;
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        ComponentSet *set = &world->components[type];
+        int count, sparseCapacity;
+        if (!ReadSnapshotBytes(reader, &count, sizeof(count)) ||
+            !ReadSnapshotBytes(reader, &sparseCapacity, sizeof(sparseCapacity))) return false;
+        if (!grow_dense(set, count)) return false;
+        if (sparseCapacity > 0 && !grow_sparse(set, sparseCapacity - 1)) return false;
+
+        set->count = count;
+        if (!ReadSnapshotBytes(reader, set->data, (size_t)count * set->size) ||
+            !ReadSnapshotBytes(reader, set->slots, count * sizeof(int32_t)) ||
+            !ReadSnapshotBytes(reader, set->sparse, sparseCapacity * sizeof(int32_t))) return false;
+        for (int i = sparseCapacity; i < set->sparseCapacity; i++) set->sparse[i] = -1;
+    }
+    return true;
+}
+
+// Collider box in world coordinates - anchored at the transform's top-left corner
+Rectangle GetColliderRect(const Transform *transform, const Collider *collider) {
+    return (Rectangle){
+        transform->position.x,
+        transform->position.y,
+        collider->size.x,
+        collider->size.y
+    };
+}
+
+// Sprite system - every visible sprite near view goes to the queue, between its last two ticks
+void DrawSprites(const World *world, float alpha, Rectangle view, RenderQueue *queue) {
+    const ComponentSet *sprites = &world->components[COMPONENT_SPRITE];
+    for (int i = 0; i < sprites->count; i++) {
+        const Sprite *sprite = ComponentAt(sprites, i);
+        SpriteRef sheet = GetSpriteById(sprite->sheet);
+        if (!sprite->visible || sprite->frame < 0 || sprite->frame >= sheet.frameCount) continue;
+        const Transform *transform = GetComponentOfSlot(world, sprites->slots[i], COMPONENT_TRANSFORM);
+        if (!transform) continue;
+
+        Rectangle source = sheet.frames[sprite->frame];
+        Vector2 position = Vector2Lerp(transform->previousPosition, transform->position, alpha);
+        Rectangle dest = {
+            position.x,
+            position.y,
+            (sprite->size.x > 0 ? sprite->size.x : source.width) * transform->scale,
+            (sprite->size.y > 0 ? sprite->size.y : source.height) * transform->scale
+        };
+        if (dest.x > view.x + view.width || dest.x + dest.width < view.x ||
+            dest.y > view.y + view.height || dest.y + dest.height < view.y) continue;
+
+        if (sprite->flipX) source.width = -source.width;
+        SubmitSprite(queue, RENDER_LAYER_ENTITIES, sprite->depth, *GetTexture(sheet.texture), source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+    }
+}
@@ -0,0 +1,154 @@
+#ifndef ECS_H
+#define ECS_H
+
+// Include necessary libraries
+#include "raylib.h"       // Vector2 / Rectangle / Color
+#include "atlas.h"        // Sprite frames from the shared atlas
+#include "animation.h"    // Clip playback state (Animator)
+#include "entity_pool.h"  // Entity ids (handles with generations)
+#include "render_queue.h" // Sorted per-frame draw list
+#include <stddef.h>
+
+/*
+    Entity-component-system core
+    An entity is just a handle. Each component type lives in its own sparse set:
+        -dense: the components packed in [0, count), plus the entity slot owning each one
+        -sparse: per entity slot, where its component sits in dense (-1 = none)
+    Systems walk a dense array front to back (no holes, no per-entity pointers) and look up the
+    other components they need through the sparse tables. Add/remove are O(1): removing moves the
+    last component into the hole, like the entity pool does.
+    Pointers from GetComponent / AddComponent are only good until the next add or remove on that
+    component type (the dense array can move or be reordered).
+*/
+typedef enum ComponentType {
+    COMPONENT_TRANSFORM,
+    COMPONENT_VELOCITY,
+    COMPONENT_COLLIDER,
+    COMPONENT_SPRITE,
+    COMPONENT_HEALTH,
+    COMPONENT_AI,
+    COMPONENT_TYPE_COUNT
+} ComponentType;
+
+// Where an entity is and which way it faces
+typedef struct Transform {
+    Vector2 position;         // Top-left corner in world coordinates
+    Vector2 previousPosition; // Position before the last tick (drawing interpolates between the two)
+    float scale;              // Draw / collision scale
+    bool facingRight;
+} Transform;
+
+// Movement in pixels per second (moved against the tile grid)
+typedef struct Velocity {
+    Vector2 value;
+    bool grounded;            // Standing on a tile after the last move
+} Velocity;
+
+// Box at the transform position, registered with the broadphase each tick
+typedef struct Collider {
+    Vector2 size;             // World-space size (scale already applied)
+    unsigned int kind;        // BODY_* bit of this entity
+    unsigned int mask;        // BODY_* bits it wants contacts with
+    bool enabled;             // Off = not registered (dead entities)
+} Collider;
+
+// One atlas frame, drawn at the interpolated transform position
+typedef struct Sprite {
+    int sheet;                // Atlas sprite id to pick frames from (-1 = none)
+    int frame;                // Frame drawn (index into the sprite's frames)
+    Vector2 size;             // Draw size before scale (0 = the frame's own size)
+    int depth;                // Order inside RENDER_LAYER_ENTITIES
+    bool flipX;               // Mirror horizontally
+    bool visible;
+} Sprite;
+
+// Hit points, and how the health bar shows them
+typedef struct Health {
+    int current;
+    int max;
+    Color barColor;           // Health bar fill (BLANK = green / yellow / red by what's left)
+} Health;
+
+// Behaviour - which system drives the entity, and that system's state
+typedef enum AiKind {
+    AI_PLAYER,                // Driven by the tick's CharacterInput
+    AI_BOSS                   // Phased boss fight
+} AiKind;
+
+// Player state - animation playing and the shooting cooldown
+typedef struct PlayerAi {
+    Animator animator;        // Idle / run / jump clip
+    float shootTimer;         // Time until the next shot is allowed
+} PlayerAi;
+
+// Boss state - phases, abilities and the death animation
+typedef struct BossAi {
+    Animator move;            // Movement/attack clip (frames drawn facing right)
+    Animator death;           // Death clip (started once health reaches zero)
+    Vector2 spawn;            // Original spawn location (movement bounds are relative to it)
+    float speed;              // Base movement speed
+    int phase;                // Current phase of the fight (1, 2, 3)
+    bool isDashing;           // Dash attack in progress
+    float dashTimer;          // Time since the dash started / ended
+    float dashCooldown;       // Time between dashes
+    float dashSpeed;          // Speed during a dash
+    float zigzagTimer;        // Zigzag oscillation time
+    float zigzagAmplitude;    // How wide the zigzag swings
+    float zigzagFrequency;    // How fast the zigzag oscillates
+    float teleportTimer;      // Time since the last teleport
+    float teleportCooldown;   // Time between teleports
+    bool isFlying;            // Phase 3 flies (different movement rules)
+    bool isDead;              // Health reached zero
+} BossAi;
+
+typedef struct Ai {
+    AiKind kind;
+    bool paused;              // Frozen (game over)
+    union {
+        PlayerAi player;
+        BossAi boss;
+    };
+} Ai;
+
+// One sparse set - see above
+typedef struct ComponentSet {
+    unsigned char *data;      // Dense components
+    int32_t *slots;           // Dense: entity slot owning each component
+    int32_t *sparse;          // Per entity slot: dense index (-1 = none)
+    size_t size;              // Bytes per component
+    int count, capacity;      // Dense
+    int sparseCapacity;
+} ComponentSet;
+
+typedef struct World {
+    EntityPool entities;
+    ComponentSet components[COMPONENT_TYPE_COUNT];
+} World;
+
+// Function declarations - world and entities
+bool InitWorld(World *world);                                                  // Empty world
+void FreeWorld(World *world);                                                  // Free every entity and component
+EntityHandle CreateEntity(World *world);                                       // New entity with no components
+void DestroyEntity(World *world, EntityHandle entity);                         // Remove the entity and all its components
+bool IsEntityAlive(const World *world, EntityHandle entity);
+
+// Function declarations - components (pointers follow the rule above)
+void *AddComponent(World *world, EntityHandle entity, ComponentType type);     // Zeroed component (the existing one if already there, NULL if out of memory)
+void RemoveComponent(World *world, EntityHandle entity, ComponentType type);
+void *GetComponent(const World *world, EntityHandle entity, ComponentType type); // NULL if missing or the entity is gone
+void *GetComponentOfSlot(const World *world, int32_t slot, ComponentType type);  // Same, for a slot from a dense walk
+
+// Function declarations - snapshots (components are plain data, so they're copied as bytes)
+void SaveWorld(const World *world, Snapshot *snapshot);                        // Append every entity and component
+bool LoadWorld(World *world, SnapshotReader *reader);                          // Replace them with a saved world (false if the snapshot is short)
+
+// Dense walk: for (int i = 0; i < set->count; i++) { T *c = ComponentAt(set, i); ... set->slots[i] ... }
+static inline void *ComponentAt(const ComponentSet *set, int index) {
+    return set->data + (size_t)index * set->size;
+}
+
+// Systems shared by every entity kind
+Rectangle GetColliderRect(const Transform *transform, const Collider *collider); // World-space box
+void DrawSprites(const World *world, float alpha, Rectangle view, RenderQueue *queue); // Submit visible sprites (alpha: 0 = previous tick, 1 = last tick)
+
+#endif
@@ -0,0 +1,126 @@
+#include "entity_pool.h"
+#include "raylib.h"  // TraceLog
+#include <stdlib.h>
+#include <string.h>
+
+// Reallocate every table to capacity slots (contents past the old capacity are left as they come)
+static bool resize_tables(EntityPool *pool, int capacity) {
+    uint32_t *generations = realloc(pool->generations, capacity * sizeof(uint32_t));
+    if (generations) pool->generations = generations;
+    int32_t *slotIndex = realloc(pool->slotIndex, capacity * sizeof(int32_t));
+    if (slotIndex) pool->slotIndex = slotIndex;
+    int32_t *denseSlot = realloc(pool->denseSlot, capacity * sizeof(int32_t));
+    if (denseSlot) pool->denseSlot = denseSlot;
+    int32_t *freeSlots = realloc(pool->freeSlots, capacity * sizeof(int32_t));
+    if (freeSlots) pool->freeSlots = freeSlots;
+    if (!generations || !slotIndex || !denseSlot || !freeSlots) {
+        TraceLog(LOG_WARNING, "POOL: Out of memory resizing to %d items", capacity);
+        return false;
+    }
+    return true;
+}
+
+// Grow every table to capacity slots - new slots are free, handed out lowest first
+static bool grow_pool(EntityPool *pool, int capacity) {
+    if (!resize_tables(pool, capacity)) return false;
+
+    for (int slot = pool->capacity; slot < capacity; slot++) {
+        pool->generations[slot] = 1;   // Generation 0 never matches, so zeroed handles are invalid
+        pool->slotIndex[slot] = -1;
+    }
+    for (int slot = capacity - 1; slot >= pool->capacity; slot--) {
+        pool->freeSlots[pool->freeCount++] = slot;
+    }
+    pool->capacity = capacity;
+    return true;
+}
+
+bool InitEntityPool(EntityPool *pool, int capacity) {
+    memset(pool, 0, sizeof(*pool));
+    return grow_pool(pool, capacity > 0 ? capacity : 1);
+}
+
+void FreeEntityPool(EntityPool *pool) {
+    free(pool->generations);
+    free(pool->slotIndex);
+    free(pool->denseSlot);
+    free(pool->freeSlots);
+    memset(pool, 0, sizeof(*pool));
+}
+
+void ClearEntityPool(EntityPool *pool) {
+    while (pool->count > 0) DespawnEntityAt(pool, pool->count - 1);
+}
+
+int SpawnEntity(EntityPool *pool, EntityHandle *handle) {
+    if (pool->freeCount == 0 && !grow_pool(pool, pool->capacity > 0 ? pool->capacity * 2 : 1)) {
+        *handle = NULL_ENTITY;
+        return -1;
+    }
+
+    int slot = pool->freeSlots[--pool->freeCount];
+    int index = pool->count++;
+    pool->slotIndex[slot] = index;
+    pool->denseSlot[index] = slot;
+    *handle = (EntityHandle){ slot, pool->generations[slot] };
+    return index;
+}
+
+int DespawnEntityAt(EntityPool *pool, int index) {
+    int slot = pool->denseSlot[index];
+    int last = --pool->count;
+
+    // The last item fills the hole (owners move their data the same way)
+    int lastSlot = pool->denseSlot[last];
+    pool->denseSlot[index] = lastSlot;
+    pool->slotIndex[lastSlot] = index;
+
+    pool->slotIndex[slot] = -1;
+    if (++pool->generations[slot] == 0) pool->generations[slot] = 1;  // Outstanding handles to this item go stale
+    pool->freeSlots[pool->freeCount++] = slot;
+    return index;
+}
+
+int DespawnEntity(EntityPool *pool, EntityHandle handle) {
+    int index = GetEntityIndex(pool, handle);
+    return index < 0 ? -1 : DespawnEntityAt(pool, index);
+}
+
+int GetEntityIndex(const EntityPool *pool, EntityHandle handle) {
+    if (handle.slot < 0 || handle.slot >= pool->capacity) return -1;
+    if (pool->generations[handle.slot] != handle.generation) return -1;
+    return pool->slotIndex[handle.slot];
+}
+
+EntityHandle GetEntityHandle(const EntityPool *pool, int index) {
+    int slot = pool->denseSlot[index];
+    return (EntityHandle){ slot, pool->generations[slot] };
+}
+
+// Counts, then each table up to what's in use (free slots past count hold nothing worth keeping)
+void SaveEntityPool(const EntityPool *pool, Snapshot *snapshot) {
+    WriteSnapshot(snapshot, &pool->freeCount, sizeof(pool->freeCount));
+    WriteSnapshot(snapshot, &pool->count, sizeof(pool->count));
+    WriteSnapshot(snapshot, &pool->capacity, sizeof(pool->capacity));
+    WriteSnapshot(snapshot, pool->generations, pool->capacity * sizeof(uint32_t));
+    WriteSnapshot(snapshot, pool->slotIndex, pool->capacity * sizeof(int32_t));
+    WriteSnapshot(snapshot, pool->denseSlot, pool->count * sizeof(int32_t));
+    WriteSnapshot(snapshot, pool->freeSlots, pool->freeCount * sizeof(int32_t));
+}
+
+// The pool takes the saved capacity, so free slots and generations line up with the save
+// (tables only ever grow - a bigger allocation than capacity is fine)
+bool LoadEntityPool(EntityPool *pool, SnapshotReader *reader) {
+    int freeCount, count, capacity;
+    if (!ReadSnapshotBytes(reader, &freeCount, sizeof(freeCount)) ||
+        !ReadSnapshotBytes(reader, &count, sizeof(count)) ||
+        !ReadSnapshotBytes(reader, &capacity, sizeof(capacity))) return false;
+    if (capacity > pool->capacity && !resize_tables(pool, capacity)) return false;
+    pool->freeCount = freeCount;
+    pool->count = count;
+    pool->capacity = capacity;
+    return ReadSnapshotBytes(reader, pool->generations, capacity * sizeof(uint32_t)) &&
+           ReadSnapshotBytes(reader, pool->slotIndex, capacity * sizeof(int32_t)) &&
+           ReadSnapshotBytes(reader, pool->denseSlot, count * sizeof(int32_t)) &&
+           ReadSnapshotBytes(reader, pool->freeSlots, freeCount * sizeof(int32_t));
+}
@@ -0,0 +1,49 @@
+#ifndef ENTITY_POOL_H
+#define ENTITY_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "snapshot.h"  // Saving / restoring the tables
+
+// Handle to a pooled item - stays valid until that item is despawned, then never matches again
+typedef struct EntityHandle {
+    int32_t slot;            // Slot in the pool (-1 = no item)
+    uint32_t generation;     // Generation of the slot when the handle was made
+} EntityHandle;
+
+#define NULL_ENTITY ((EntityHandle){ -1, 0 })
+
+/*
+    Entity pool - bookkeeping for a growable set of items with stable handles
+    The pool doesn't hold item data. Owners keep their data in dense arrays indexed
+    [0, count), so updates walk packed memory, and follow the pool's moves:
+        -spawn appends at index count - 1 (capacity doubles when full, nothing is refused)
+        -despawn returns the index it freed; the item at the old last index (== count after the
+         call) moves into it, so owners copy their data from count to the returned index
+    Handles go through a slot table (slot -> dense index), so they survive those moves. Every
+    despawn bumps the slot's generation, so a handle to a despawned item is detected as stale
+    even after its slot has been reused. Free slots form a stack, so spawn and despawn are O(1)
+*/
+typedef struct EntityPool {
+    uint32_t *generations;   // Per slot: current generation
+    int32_t *slotIndex;      // Per slot: dense index of its item (-1 = free)
+    int32_t *denseSlot;      // Per dense index: slot owning it
+    int32_t *freeSlots;      // Stack of free slots
+    int freeCount;
+    int count;               // Live items
+    int capacity;            // Slots (owners size their dense arrays to this)
+} EntityPool;
+
+// Function declarations - entity pools
+bool InitEntityPool(EntityPool *pool, int capacity);
+void FreeEntityPool(EntityPool *pool);
+void ClearEntityPool(EntityPool *pool);                                  // Despawn everything (outstanding handles go stale)
+int SpawnEntity(EntityPool *pool, EntityHandle *handle);                 // Dense index of the new item (-1 only if memory runs out)
+int DespawnEntity(EntityPool *pool, EntityHandle handle);                // Freed dense index (-1 for a stale handle)
+int DespawnEntityAt(EntityPool *pool, int index);                        // Same, by dense index (returns index)
+int GetEntityIndex(const EntityPool *pool, EntityHandle handle);         // Dense index of a live item (-1 if stale)
+EntityHandle GetEntityHandle(const EntityPool *pool, int index);         // Handle of the item at a dense index
+void SaveEntityPool(const EntityPool *pool, Snapshot *snapshot);         // Append the tables to a snapshot
+bool LoadEntityPool(EntityPool *pool, SnapshotReader *reader);           // Read them back (false if the snapshot is short)
+
+#endif
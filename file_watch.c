@@ -0,0 +1,97 @@
+#include "file_watch.h"
+#include <string.h>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+void InitFileWatch(FileWatch *watch) {
+    memset(watch, 0, sizeof(*watch));
+#ifdef __linux__
+    watch->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#else
+    watch->fd = -1;
+#endif
+}
+
+void WatchFile(FileWatch *watch, const char *path) {
+    if (watch->count >= MAX_WATCHED_FILES || strlen(path) >= ASSET_PATH_LENGTH) return;
+    for (int i = 0; i < watch->count; i++) {
+        if (strcmp(watch->files[i].path, path) == 0) return;
+    }
+
+    WatchedFile *file = &watch->files[watch->count++];
+    strcpy(file->path, path);
+    const char *slash = strrchr(file->path, '/');
+    file->nameOffset = slash ? (int)(slash - file->path) + 1 : 0;
+    file->modTime = GetFileModTime(path);
+    file->changed = false;
+    file->wd = -1;
+
+#ifdef __linux__
+    if (watch->fd >= 0) {
+        // Watch the directory - a file replaced by a rename would silently drop a watch on the file itself
+        char directory[ASSET_PATH_LENGTH] = ".";
+        if (slash) {
+            memcpy(directory, file->path, slash - file->path);
+            directory[slash - file->path] = '\0';
+            if (directory[0] == '\0') strcpy(directory, "/");
+        }
+        file->wd = inotify_add_watch(watch->fd, directory, IN_CLOSE_WRITE | IN_MOVED_TO);
+    }
+#endif
+}
+
+// Mark files whose directory reported a finished write / rename onto their name
+static void read_events(FileWatch *watch) {
+#ifdef __linux__
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t length;
+    while ((length = read(watch->fd, buffer, sizeof(buffer))) > 0) {
+        for (char *p = buffer; p < buffer + length; p += sizeof(struct inotify_event) + ((struct inotify_event *)p)->len) {
+            const struct inotify_event *event = (const struct inotify_event *)p;
+            if (event->len == 0) continue;
+            for (int i = 0; i < watch->count; i++) {
+                if (watch->files[i].wd == event->wd && strcmp(watch->files[i].path + watch->files[i].nameOffset, event->name) == 0) {
+                    watch->files[i].changed = true;
+                }
+            }
+        }
+    }
+#endif
+}
+
+int PollFileWatch(FileWatch *watch, const char **changed, int maxChanged) {
+    double now = GetTime();
+    if (now < watch->nextCheck) return 0;
+    watch->nextCheck = now + FILE_WATCH_INTERVAL;
+
+    if (watch->fd >= 0) read_events(watch);
+
+    int count = 0;
+    for (int i = 0; i < watch->count; i++) {
+        WatchedFile *file = &watch->files[i];
+        if (file->wd < 0) {
+            // Polling fallback
+            long modTime = GetFileModTime(file->path);
+            if (modTime != file->modTime) {
+                file->modTime = modTime;
+                file->changed = true;
+            }
+        }
+        if (file->changed && count < maxChanged) {
+            file->changed = false;
+            changed[count++] = file->path;
+        }
+    }
+    return count;
+}
+
+void FreeFileWatch(FileWatch *watch) {
+#ifdef __linux__
+    if (watch->fd >= 0) close(watch->fd);  // Closing drops every watch
+#endif
+    watch->fd = -1;
+    watch->count = 0;
+}
@@ -0,0 +1,39 @@
+#ifndef FILE_WATCH_H
+#define FILE_WATCH_H
+
+// Include necessary libraries
+#include "assets.h"  // ASSET_PATH_LENGTH (watched files are mostly cached textures)
+
+// File watch constants
+#define MAX_WATCHED_FILES 64         // Maximum number of files watched at once
+#define FILE_WATCH_INTERVAL 0.25     // Seconds between checks (editors save in several writes)
+
+// One watched file
+typedef struct WatchedFile {
+    char path[ASSET_PATH_LENGTH];    // Path as given to WatchFile
+    int nameOffset;                  // Start of the file name in path (what directory events carry)
+    int wd;                          // inotify watch of the file's directory (-1 when polling)
+    long modTime;                    // Last seen modification time (polling fallback)
+    bool changed;                    // Changed since the last poll
+} WatchedFile;
+
+/*
+    Change notification for a handful of files
+    Linux uses inotify on the files' directories, so editors that save through a temporary file
+    and a rename are still seen. Everywhere else (or if inotify is unavailable) modification
+    times are polled every FILE_WATCH_INTERVAL seconds.
+*/
+typedef struct FileWatch {
+    int fd;                          // inotify descriptor (-1 = polling)
+    WatchedFile files[MAX_WATCHED_FILES];
+    int count;
+    double nextCheck;                // GetTime() of the next check
+} FileWatch;
+
+// Function declarations - file watching
+void InitFileWatch(FileWatch *watch);
+void WatchFile(FileWatch *watch, const char *path);   // Start watching (no-op if already watched or the list is full)
+int PollFileWatch(FileWatch *watch, const char **changed, int maxChanged); // Paths changed since the last poll
+void FreeFileWatch(FileWatch *watch);
+
+#endif
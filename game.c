@@ -1,141 +1,464 @@
 #include "game.h"
 #include "map_renderer.h"
+#include "jobs.h"
+#include "particles.h"
 #include "raymath.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
 
-// Initializer
+// Load the sprite atlas and the animation clips cut from it once (pages stay loaded so restarts reuse them)
+bool PreloadGameAssets(void) {
+    if (!LoadSpriteAtlas(SPRITE_ATLAS_PATH, SPRITE_MANIFEST_PATH)) return false;
+    if (!LoadAnimationClips(ANIMATION_CLIPS_PATH)) {
+        UnloadSpriteAtlas();
+        return false;
+    }
+    return true;
+}
+
+// Release the clips and the sprite atlas
+void UnloadGameAssets(void) {
+    UnloadAnimationClips();
+    UnloadSpriteAtlas();
+}
+
+// Player spawn from the object layer (Hardcoded the spawn point if it fails )
+static Vector2 player_spawn(const Level *level) {
+    return FindLevelSpawn(level, "p_spawn", (Vector2){343, 471});
+}
+
+// Camera the game starts with - the loader pre-bakes what it will see
+Camera2D GetSpawnCamera(const Level *level) {
+    Camera2D camera;
+    camera.offset = (Vector2){DISPLAY_W / 2, DISPLAY_H / 2}; // Center camera
+    camera.target = player_spawn(level);                     // Follow player
+    camera.rotation = 0.0f;                                  // No rotation
+    // Calculate zoom to fit map height with some padding
+    camera.zoom = (float)DISPLAY_H / GetLevelPixelHeight(level) * 1.5f;
+    return camera;
+}
+
+// Everything after the level and its chunk cache exist (cheap - no file or GPU work)
+static void start_game(GameState *game) {
+    // The collision bitmap was merged at compile time, so per-frame queries never walk the layers
+    UseLevelCollision(&game->collision, &game->level);
+    InitBroadphase(&game->broadphase, BROADPHASE_CELL_SIZE);
+    InitHud(&game->hud);
+    game->renderQueue = (RenderQueue){0};
+    game->sim.tick = 0;
+    InitWorld(&game->world);
+
+    // Spawn points from the object layers (Hardcoded the spawn points if it fails )
+    Vector2 boss_spawn = FindLevelSpawn(&game->level, "boss_spawn", (Vector2){4695.33, 475});
+
+    // Player and boss entities, and the projectile system
+    game->sim.player = SpawnPlayer(&game->world, player_spawn(&game->level), game->level.header->tileHeight);
+    InitProjectiles();
+    InitParticles();
+    game->sim.boss = SpawnBoss(&game->world, boss_spawn);
+
+    // camera setup - level chunks and baked textures follow it from here on
+    game->sim.camera = GetSpawnCamera(&game->level);
+    game->sim.previousCameraTarget = game->sim.camera.target;
+    InitWorldStreamer(&game->streamer, game->sim.camera);
+
+    // Live games get a fresh seed - headless runs and replays set their own with SeedGame
+    SeedGame(game, (uint32_t)time(NULL));
+    game->replay = NULL;
+
+    // Simulation clock
+    game->inputSource = KeyboardInput();
+    game->input = (CharacterInput){0};
+    game->accumulator = 0.0f;
+    game->alpha = 1.0f;
+
+    // Initialize game state variables
+    game->sim.wasColliding = false;     // Previous collision state
+    game->sim.gameOver = false;         // Game over flag
+    game->sim.playerWon = false;        // Victory flag
+
+    // No rewinding unless asked for
+    memset(&game->history, 0, sizeof(game->history));
+    game->keepHistory = false;
+}
+
+// Initializer (blocking - loads and bakes everything now)
 void InitGame(GameState *game, const char *mapPath) {
-    // Set up TMX library to use Raylib's texture loading system
-    tmx_img_load_func = raylib_tex_loader;
-    tmx_img_free_func = raylib_free_tex;
-
-    // Load the tilemap from file
-    game->map = tmx_load(mapPath);
-    if (!game->map) {
-        tmx_perror("tmx_load");
+    // Load the level - a compiled .mrmap is mapped and used in place, a .tmx is compiled on the fly
+    if (!LoadLevel(&game->level, mapPath)) {
         exit(1); // Exit if map fails 
     }
+    if (!LoadLevelTextures(&game->level)) {
+        UnloadLevel(&game->level);
+        exit(1);
+    }
 
-    // Initialize 
-    // player animation and projectile system
-    InitAnimation(&game->player, game->map->tile_height);
-    InitProjectiles();
+    // Chunk cache for the static tile layers (the first frame bakes what the camera sees)
+    LoadMapRenderCache(&game->mapCache, &game->level);
+    start_game(game);
+}
 
-    // Default spawn positions (Hardcoded the spawn points if it fails )
-    Vector2 player_spawn = {343, 471};
-    Vector2 boss_spawn = {4695.33, 475};
-
-    // Search through map layers to find spawn points
-    tmx_layer *layer = game->map->ly_head;
-    while (layer) {
-        if (layer->type == L_OBJGR) { 
-            // player spawn 
-            if (strcmp(layer->name, "p_spawn") == 0) {
-                tmx_object *obj = layer->content.objgr->head;
-                if (obj) {
-                    player_spawn.x = obj->x;
-                    player_spawn.y = obj->y;
-                }
-            }
-            // boss spawn 
-            else if (strcmp(layer->name, "boss_spawn") == 0) {
-                tmx_object *obj = layer->content.objgr->head;
-                if (obj) {
-                    boss_spawn.x = obj->x;
-                    boss_spawn.y = obj->y;
-                }
-            }
-        }
-        layer = layer->next;
+// Initializer for a level the loader already prepared in the background
+void InitGameFromLoader(GameState *game, LevelLoader *loader) {
+    TakeLoadedLevel(loader, &game->level, &game->mapCache);
+    start_game(game);
+}
+
+/*
+    Hot reload: swap in a fresh copy of the level without touching the entities or projectiles.
+    Unchanged tilesets keep their textures (cache hits), the collision grid is pointed at the new
+    bitmap, and only the baked chunks over edited tiles are rebaked. If the map's size, layers or
+    tilesets changed, the chunk cache starts over around the camera instead.
+*/
+bool ReloadGameLevel(GameState *game, const char *mapPath) {
+    Level fresh;
+    if (!LoadLevel(&fresh, mapPath)) return false;  // Half-saved or broken file - keep playing the old one
+    if (!LoadLevelTextures(&fresh)) {
+        UnloadLevel(&fresh);
+        return false;
+    }
+
+    if (!MarkMapLevelChanges(&game->mapCache, &game->level, &fresh)) {
+        UnloadMapRenderCache(&game->mapCache);
+        LoadMapRenderCache(&game->mapCache, &fresh);
     }
+    UnloadLevel(&game->level);
+    game->level = fresh;
+    UseLevelCollision(&game->collision, &game->level);
+    return true;
+}
 
-    // Set player and boss positions
-    game->player.position = player_spawn;
-    InitBoss(&game->boss, boss_spawn, game->map);
+void SeedGame(GameState *game, uint32_t seed) {
+    game->seed = seed;
+    SeedRng(&game->sim.rng, seed);
+}
 
-    // camera setup 
-    game->camera.offset = (Vector2){DISPLAY_W / 2, DISPLAY_H / 2}; // Center camera
-    game->camera.target = game->player.position;                    // Follow player
-    game->camera.rotation = 0.0f;                                   // No rotation
-    // Calculate zoom to fit map height with some padding
-    game->camera.zoom = (float)DISPLAY_H / (game->map->height * game->map->tile_height) * 1.5f;
+void AttachReplay(GameState *game, Replay *replay) {
+    game->replay = replay;
+    if (!replay->recording) SeedGame(game, replay->header.seed);
+}
 
-    // Initialize game state variables
-    game->shootTimer = 0.0f;        // Shooting cooldown timer
-    game->wasColliding = false;     // Previous collision state
-    game->gameOver = false;         // Game over flag
-    game->playerWon = false;        // Victory flag
+// FNV-1a over the fields that make up the simulation (bit patterns of floats included)
+static uint32_t hash_bytes(uint32_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+#define HASH_FIELD(field) hash = hash_bytes(hash, &(field), sizeof(field))
+
+/*
+    State checksum for replays - field by field, since whole structs would pull in padding bytes
+    and draw-only fields (sprite frames, scale) that say nothing about the simulation
+*/
+uint32_t ChecksumGame(const GameState *game) {
+    uint32_t hash = 2166136261u;
+
+    const World *world = &game->world;
+    const Transform *playerTransform = GetComponent(world, game->sim.player, COMPONENT_TRANSFORM);
+    const Velocity *playerVelocity = GetComponent(world, game->sim.player, COMPONENT_VELOCITY);
+    const Health *playerHealth = GetComponent(world, game->sim.player, COMPONENT_HEALTH);
+    const Ai *playerAi = GetComponent(world, game->sim.player, COMPONENT_AI);
+    HASH_FIELD(playerTransform->position);
+    HASH_FIELD(playerVelocity->value);
+    HASH_FIELD(playerHealth->current);
+    HASH_FIELD(playerVelocity->grounded);
+    HASH_FIELD(playerTransform->facingRight);
+    HASH_FIELD(playerAi->player.animator.clip);
+    HASH_FIELD(playerAi->player.animator.frame);
+    HASH_FIELD(playerAi->paused);
+
+    const Transform *bossTransform = GetComponent(world, game->sim.boss, COMPONENT_TRANSFORM);
+    const Health *bossHealth = GetComponent(world, game->sim.boss, COMPONENT_HEALTH);
+    const BossAi *boss = &((const Ai *)GetComponent(world, game->sim.boss, COMPONENT_AI))->boss;
+    HASH_FIELD(bossTransform->position);
+    HASH_FIELD(bossHealth->current);
+    HASH_FIELD(boss->phase);
+    HASH_FIELD(bossTransform->facingRight);
+    HASH_FIELD(boss->isDashing);
+    HASH_FIELD(boss->dashTimer);
+    HASH_FIELD(boss->teleportTimer);
+    HASH_FIELD(boss->move.frame);
+    HASH_FIELD(boss->death.frame);
+
+    const ProjectilePool *pool = &projectiles;
+    HASH_FIELD(pool->ids.count);
+    hash = hash_bytes(hash, pool->x, pool->ids.count * sizeof(float));
+    hash = hash_bytes(hash, pool->y, pool->ids.count * sizeof(float));
+    hash = hash_bytes(hash, pool->velocityX, pool->ids.count * sizeof(float));
+    hash = hash_bytes(hash, pool->velocityY, pool->ids.count * sizeof(float));
+
+    HASH_FIELD(game->sim.camera.target);
+    HASH_FIELD(playerAi->player.shootTimer);
+    HASH_FIELD(game->sim.wasColliding);
+    HASH_FIELD(game->sim.gameOver);
+    HASH_FIELD(game->sim.playerWon);
+    HASH_FIELD(game->sim.rng.state);
+    return hash;
+}
+
+/*
+    Snapshot layout: the GameSim block, the world, the projectile pool. Each part writes its
+    counts and then its live arrays, so the size follows what's alive - a few KB for a normal
+    fight - and restoring is the same copies in reverse
+*/
+void SaveGameSnapshot(const GameState *game, Snapshot *snapshot) {
+    BeginSnapshot(snapshot);
+    WriteSnapshot(snapshot, &game->sim, sizeof(game->sim));
+    SaveWorld(&game->world, snapshot);
+    SaveProjectiles(snapshot);
+    snapshot->tick = game->sim.tick;
+    snapshot->hash = ChecksumGame(game);
+}
+
+bool RestoreGameSnapshot(GameState *game, const Snapshot *snapshot) {
+    SnapshotReader reader = ReadSnapshot(snapshot);
+    GameSim sim;
+    if (!ReadSnapshotBytes(&reader, &sim, sizeof(sim))) return false;
+    if (!LoadWorld(&game->world, &reader) || !LoadProjectiles(&reader)) {
+        // Only a lack of memory gets here, with the world half copied - nothing to fall back to
+        TraceLog(LOG_ERROR, "GAME: Could not restore the snapshot of tick %ld", snapshot->tick);
+        return false;
+    }
+    game->sim = sim;
+
+    // The state has to come back exactly as saved - anything else is a snapshot bug
+    uint32_t hash = ChecksumGame(game);
+    if (hash != snapshot->hash) {
+        TraceLog(LOG_ERROR, "GAME: Snapshot of tick %ld restored with checksum %08x, saved as %08x",
+                 snapshot->tick, hash, snapshot->hash);
+        return false;
+    }
+    return true;
+}
+
+// Turning it on starts the history at the current tick
+void KeepGameHistory(GameState *game, bool keep) {
+    game->keepHistory = keep;
+    ClearSnapshots(&game->history);
+    if (keep) SaveGameSnapshot(game, PushSnapshot(&game->history));
+}
+
+/*
+    Rewind: the snapshot ticks back becomes the current state and the newer ones are dropped, so
+    play carries on from there (and can rewind further, down to the oldest tick held). The frame
+    clock restarts, so the first frame after draws the restored tick as is
+*/
+int RewindGame(GameState *game, int ticks) {
+    if (ticks > game->history.count - 1) ticks = game->history.count - 1;
+    if (ticks <= 0) return 0;
+    if (!RestoreGameSnapshot(game, GetSnapshot(&game->history, ticks))) return 0;
+    DropSnapshots(&game->history, ticks);
+    game->accumulator = 0.0f;
+    game->alpha = 1.0f;
+    return ticks;
+}
+
+/*
+    Fixed-step loop: frame time goes into an accumulator and whole SIM_DT ticks are taken out, so
+    physics and AI behave the same at 30 or 240 FPS. What's left over becomes alpha, and drawing
+    blends each entity between its last two tick positions by it. A frame that would need more
+    than SIM_MAX_TICKS_PER_FRAME ticks (breakpoint, window drag, slow machine) drops the rest
+    and runs slow for a moment, instead of falling further behind every frame.
+*/
+void AdvanceGame(GameState *game, float frameTime) {
+    // Held controls are sampled now, presses are kept until a tick has used them
+    // (playback brings its own controls per tick)
+    if (!game->replay || game->replay->recording) SampleInput(&game->inputSource, &game->input);
+
+    game->accumulator += frameTime;
+    int ticks = 0;
+    while (game->accumulator >= SIM_DT && ticks < SIM_MAX_TICKS_PER_FRAME) {
+        // Playback replaces the controls tick by tick (standing still once the recording ends)
+        Replay *replay = game->replay;
+        bool played = replay && !replay->recording && ReadReplayTick(replay, &game->input);
+        if (replay && !replay->recording && !played) game->input = (CharacterInput){0};
+
+        UpdateGame(game, SIM_DT);
+
+        if (replay && replay->recording) RecordReplayTick(replay, game->input, ChecksumGame(game));
+        if (played) CheckReplayTick(replay, ChecksumGame(game));
+        if (game->keepHistory) SaveGameSnapshot(game, PushSnapshot(&game->history));
+        game->input.jump = false;
+        game->input.shoot = false;
+        game->accumulator -= SIM_DT;
+        ticks++;
+    }
+    if (game->accumulator >= SIM_DT) game->accumulator = fmodf(game->accumulator, SIM_DT);
+    // Nothing moves after game over, so draw the last tick as is
+    game->alpha = game->sim.gameOver ? 1.0f : game->accumulator / SIM_DT;
+}
+
+// What the system jobs of one tick work on
+typedef struct TickJobs {
+    GameState *game;
+    float delta;
+} TickJobs;
+
+static void players_job(void *data, int begin, int end) {
+    TickJobs *tick = data;
+    UpdatePlayers(&tick->game->world, tick->delta, &tick->game->collision, tick->game->input);
 }
 
-// Updater
+static void bosses_job(void *data, int begin, int end) {
+    TickJobs *tick = data;
+    UpdateBosses(&tick->game->world, tick->delta, &tick->game->level, &tick->game->sim.rng);
+}
+
+static void projectiles_job(void *data, int begin, int end) {
+    TickJobs *tick = data;
+    UpdateProjectiles(tick->delta, &tick->game->level);
+}
+
+// Projectiles only ever hit bosses - one box tested against all of them in batch
+static void hits_job(void *data, int begin, int end) {
+    World *world = &((TickJobs *)data)->game->world;
+    ComponentSet *colliders = &world->components[COMPONENT_COLLIDER];
+    for (int i = 0; i < colliders->count; i++) {
+        Collider *collider = ComponentAt(colliders, i);
+        if (!collider->enabled || collider->kind != BODY_BOSS) continue;
+        Transform *transform = GetComponentOfSlot(world, colliders->slots[i], COMPONENT_TRANSFORM);
+        Health *health = GetComponentOfSlot(world, colliders->slots[i], COMPONENT_HEALTH);
+        if (transform && health) HitProjectiles(GetColliderRect(transform, collider), health);
+    }
+}
+
+/*
+    The tick's systems as a job graph:
+        players -> projectiles -> hits
+        bosses --------------------^
+    Players and bosses touch different entities (and only bosses draw from the RNG), so they run
+    side by side. Projectiles move after the player's shot is in the pool, and are tested against
+    bosses once both have moved. Projectile movement and hit tests split into parallel batches
+    themselves; everything that removes or spawns stays in a fixed order, so a tick comes out the
+    same on any number of threads.
+*/
+static void run_systems(GameState *game, float delta) {
+    TickJobs tick = { game, delta };
+    JobGraph graph;
+    ClearJobGraph(&graph);
+    int players = AddJob(&graph, players_job, &tick, 1, 1);
+    int bosses = AddJob(&graph, bosses_job, &tick, 1, 1);
+    int moved = AddJob(&graph, projectiles_job, &tick, 1, 1);
+    int hits = AddJob(&graph, hits_job, &tick, 1, 1);
+    AddJobDependency(&graph, players, moved);
+    AddJobDependency(&graph, moved, hits);
+    AddJobDependency(&graph, bosses, hits);
+    RunJobGraph(&graph);
+}
+
+// Updater - one simulation tick
 void UpdateGame(GameState *game, float delta) {
+    game->sim.tick++;
+    game->sim.previousCameraTarget = game->sim.camera.target;
+
     // Don't update if game is over
-    if (game->gameOver) return;
-
-    // Update entities
-    UpdateCharacter(&game->player, delta, game->map, &game->shootTimer);
-    UpdateBoss(&game->boss, delta, game->map);
-    UpdateProjectiles(delta, game->map, &game->boss);
-
-    // Boss-player collision detection (only if its is alive)
-    if (!game->boss.isDead) {
-        // Calculate boss collision rectangle with scaling
-        float bossW = (game->boss.skillRight.width / 6) * 1.8f;
-        float bossH = game->boss.skillRight.height * 1.8f;
-        Rectangle bossRect = {game->boss.position.x, game->boss.position.y, bossW, bossH};
-        
-        // Calculate player collision rectangle
-        float char_w = FRAME_WIDTH * game->player.scale;
-        float char_h = FRAME_HEIGHT * game->player.scale;
-        Rectangle playerRect = {game->player.position.x, game->player.position.y, char_w, char_h};
-        
-        // Check collision and apply damage only on first contact
-        bool colliding = CheckCollisionRecs(bossRect, playerRect);
-        if (colliding && !game->wasColliding) {
-            game->player.health -= 200; 
-            if (game->player.health < 0) game->player.health = 0; 
+    if (game->sim.gameOver) return;
+
+    // Systems as a job graph (see run_systems)
+    World *world = &game->world;
+    run_systems(game, delta);
+
+    // Register every enabled collider for this tick and collect candidate pairs
+    // (body index = entity slot; a dead boss has its collider off)
+    ComponentSet *colliders = &world->components[COMPONENT_COLLIDER];
+    Broadphase *bp = &game->broadphase;
+    ClearBroadphase(bp);
+    for (int i = 0; i < colliders->count; i++) {
+        Collider *collider = ComponentAt(colliders, i);
+        Transform *transform = GetComponentOfSlot(world, colliders->slots[i], COMPONENT_TRANSFORM);
+        if (!collider->enabled || !transform) continue;
+        AddBody(bp, GetColliderRect(transform, collider), collider->kind, collider->mask, colliders->slots[i]);
+    }
+    FindBroadphasePairs(bp);
+
+    // Narrowphase: confirm each candidate pair and dispatch by body kinds
+    bool colliding = false;
+    for (int i = 0; i < bp->pairCount; i++) {
+        Body *a = &bp->bodies[bp->pairs[i].a];
+        Body *b = &bp->bodies[bp->pairs[i].b];
+        if (!CheckCollisionRecs(a->aabb, b->aabb)) continue;
+
+        unsigned int kinds = a->kind | b->kind;
+        if (kinds == (BODY_PLAYER | BODY_BOSS)) {
+            colliding = true;
         }
-        game->wasColliding = colliding; // set collision state for next frame
     }
 
+    // Player-boss contact damage, applied only on first contact
+    Transform *player = GetComponent(world, game->sim.player, COMPONENT_TRANSFORM);
+    Health *playerHealth = GetComponent(world, game->sim.player, COMPONENT_HEALTH);
+    Ai *playerAi = GetComponent(world, game->sim.player, COMPONENT_AI);
+    if (colliding && !game->sim.wasColliding) {
+        playerHealth->current -= 200; 
+        if (playerHealth->current < 0) playerHealth->current = 0; 
+    }
+    game->sim.wasColliding = colliding; // set collision state for next frame
+
     // Check game over conditions
-    if (game->player.health <= 0) {
-        game->gameOver = true;
-        game->player.isPaused = true;
+    if (playerHealth->current <= 0) {
+        game->sim.gameOver = true;
+        playerAi->paused = true;
     }
     // Player won (boss defeated and death animation finished)
-    if (game->boss.health <= 0 && game->boss.deathFinished) {
-        game->gameOver = true;
-        game->playerWon = true;
-        game->player.isPaused = true;
+    const Health *bossHealth = GetComponent(world, game->sim.boss, COMPONENT_HEALTH);
+    const Ai *bossAi = GetComponent(world, game->sim.boss, COMPONENT_AI);
+    if (bossHealth->current <= 0 && IsAnimationFinished(&bossAi->boss.death)) {
+        game->sim.gameOver = true;
+        game->sim.playerWon = true;
+        playerAi->paused = true;
     }
 
     // Update camera to follow player 
-    game->camera.target.x = game->player.position.x; // Always follow X position
+    game->sim.camera.target.x = player->position.x; // Always follow X position
     
     // Only follow Y position when player moves upward, prevent downward following
-    game->camera.target.y = fmaxf(game->camera.target.y, game->player.position.y);
+    game->sim.camera.target.y = fmaxf(game->sim.camera.target.y, player->position.y);
     
     // Fix camera Y position to stay within map boundaries
-    float map_h = game->map->height * game->map->tile_height;
-    float min_cam_y = game->camera.offset.y / game->camera.zoom;
-    float max_cam_y = map_h - (DISPLAY_H - game->camera.offset.y) / game->camera.zoom;
-    game->camera.target.y = Clamp(game->camera.target.y, min_cam_y, max_cam_y);
+    float map_h = GetLevelPixelHeight(&game->level);
+    float min_cam_y = game->sim.camera.offset.y / game->sim.camera.zoom;
+    float max_cam_y = map_h - (DISPLAY_H - game->sim.camera.offset.y) / game->sim.camera.zoom;
+    game->sim.camera.target.y = Clamp(game->sim.camera.target.y, min_cam_y, max_cam_y);
 }
 
 // Renderer
 void RenderGame(GameState *game) {
+    // Camera between the last two ticks, like the entities it follows
+    Camera2D view = game->sim.camera;
+    view.target = Vector2Lerp(game->sim.previousCameraTarget, game->sim.camera.target, game->alpha);
+
+    // Stream level chunks and baked textures around the camera, rebake changed ones
+    // (has to happen before 2D mode starts)
+    UpdateWorldStreamer(&game->streamer, &game->level, &game->mapCache, view);
+
+    // Particles move once per rendered frame (visuals only - not part of the tick)
+    float frameTime = GetFrameTime();
+    if (!game->sim.gameOver) EmitProjectileTrails(frameTime);
+    UpdateParticles(frameTime);
+
+    // Rebuild HUD panels whose values changed (also render-texture work)
+    const Ai *bossAi = GetComponent(&game->world, game->sim.boss, COMPONENT_AI);
+    UpdateHud(&game->hud, GetComponent(&game->world, game->sim.player, COMPONENT_HEALTH),
+              GetComponent(&game->world, game->sim.boss, COMPONENT_HEALTH), bossAi->boss.isDead);
+
     // Start 2D mode 
-    BeginMode2D(game->camera);
-    RenderMap(game->map, &game->player, &game->boss);
+    BeginMode2D(view);
+    RenderMap(&game->level, &game->mapCache, &game->renderQueue, view, &game->world, game->alpha);
     EndMode2D();
 
+    // HUD sits in screen space on top of the world
+    DrawHud(&game->hud);
+
     // EndcScreen
-    if (game->gameOver) {
-        const char *text = game->playerWon ? "You Win" : "You Died";
-        Color color = game->playerWon ? GREEN : RED;
+    if (game->sim.gameOver) {
+        const char *text = game->sim.playerWon ? "You Win" : "You Died";
+        Color color = game->sim.playerWon ? GREEN : RED;
         int textWidth = MeasureText(text, 60);
         DrawText(text, DISPLAY_W / 2 - textWidth / 2, DISPLAY_H / 2 - 30, 60, color);
     }
@@ -143,14 +466,26 @@ void RenderGame(GameState *game) {
 
 /*
     Clean up game resources
-    -player
-    -boss
+    -entities (player, boss)
     -projectile
+    -particles
+    -collision grid
+    -broadphase
+    -baked map chunks
+    -HUD panels
+    -render queue
     -map
+    -rewind history
 */
 void CleanupGame(GameState *game) {
-    CleanupAnimation(&game->player); 
-    CleanupBoss(&game->boss);        
+    FreeWorld(&game->world);
     CleanupProjectiles();            
-    tmx_map_free(game->map);         
+    CleanupParticles();
+    FreeCollisionGrid(&game->collision);
+    FreeBroadphase(&game->broadphase);
+    UnloadMapRenderCache(&game->mapCache);
+    UnloadHud(&game->hud);
+    FreeRenderQueue(&game->renderQueue);
+    UnloadLevel(&game->level);         
+    FreeSnapshots(&game->history);
 }
\ No newline at end of file
@@ -2,10 +2,21 @@
 #define GAME_H
 
 #include "raylib.h"      
-#include "tmx.h"         
+#include "level.h"       
+#include "ecs.h"         
 #include "character.h"   
 #include "boss.h"        
 #include "projectile.h"  
+#include "collision.h"   
+#include "broadphase.h"  
+#include "map_renderer.h"
+#include "hud.h"         
+#include "level_loader.h"
+#include "world_stream.h"
+#include "input_source.h"
+#include "replay.h"
+#include "rng.h"
+#include "snapshot.h"
 
 //========================
 //      Constants
@@ -14,21 +25,66 @@
 #define DISPLAY_H 850        //  height in pixels
 #define CAMERA_SPEED 300.0f  // Camera movement speed
 
+// Fixed-step simulation - the game always advances in SIM_DT ticks, whatever the display rate
+#define SIM_TICK_RATE 120                      // Simulation ticks per second
+#define SIM_DT (1.0f / SIM_TICK_RATE)          // Length of one tick in seconds
+#define SIM_MAX_TICKS_PER_FRAME 8              // Spiral-of-death guard: time past this many ticks in one frame is dropped
+
+/*
+    Simulation state that isn't entities or projectiles - fixed size and plain data (handles,
+    no pointers), so a snapshot copies it as one block. Together with the world and the
+    projectile pool it is everything a tick changes; the rest of GameState is loaded resources,
+    render caches and the frame clock.
+*/
+typedef struct GameSim {
+    long tick;                    // Ticks simulated since the game started
+    Camera2D camera;              // Camera
+    Vector2 previousCameraTarget; // Camera target before the last tick
+    EntityHandle player;          // player entity
+    EntityHandle boss;            // Boss entity
+    Rng rng;                      // All gameplay randomness (boss teleports) - never rand()
+    bool wasColliding;            // Track previous collision state
+    bool gameOver;                // Game over flag
+    bool playerWon;               // victory flag
+} GameSim;
+
 // GameState
 typedef struct {
-    Camera2D camera;     // Camera
-    tmx_map *map;        // map 
-    Animation player;    // player
-    Boss boss;          // Boss 
-    float shootTimer;   // Timer for shooting cooldown
-    bool wasColliding;  // Track previous collision state
-    bool gameOver;      // Game over flag
-    bool playerWon;     // victory flag
+    GameSim sim;         // Simulation values (see above)
+    World world;         // Entities and their components
+    Level level;         // map (compiled tables, used in place)
+    CollisionGrid collision; // solid tiles merged from the collidable layers
+    MapRenderCache mapCache; // static tile layers baked into chunk textures
+    WorldStreamer streamer;  // keeps level chunks and baked textures around the camera
+    Broadphase broadphase; // dynamic bodies registered each tick
+    Hud hud;             // screen-space health readouts (rebuilt only on change)
+    RenderQueue renderQueue; // sorted draw list refilled every frame
+    InputSource inputSource; // Where controls come from (keyboard unless replaced after init)
+    CharacterInput input;   // Controls gathered per frame, used by the next tick
+    float accumulator;      // Frame time not yet simulated (< SIM_DT after AdvanceGame)
+    float alpha;            // accumulator / SIM_DT - how far past the last tick to draw
+    uint32_t seed;          // Seed rng started from (what a recording stores)
+    Replay *replay;         // Recording or playback driving the ticks (NULL = live play)
+    SnapshotRing history;   // The last ticks, for rewinding (only kept when keepHistory is on)
+    bool keepHistory;
 } GameState;
 
 // Function declarations - game lifecycle management
-void InitGame(GameState *game, const char *mapPath);  // Initialize game with map file
-void UpdateGame(GameState *game, float delta);        // Update game logic each frame
+bool PreloadGameAssets(void);                         // Load the sprite atlas and animation clips once so restarts reuse them (false if either is missing)
+void UnloadGameAssets(void);                          // Release the clips and the sprite atlas
+void InitGame(GameState *game, const char *mapPath);  // Initialize game with a map file (.mrmap or .tmx), blocking
+Camera2D GetSpawnCamera(const Level *level);          // Camera a level starts with (centred on the player spawn)
+void InitGameFromLoader(GameState *game, LevelLoader *loader); // Initialize game from a READY background load
+bool ReloadGameLevel(GameState *game, const char *mapPath); // Swap in the level file again, keeping the play state
+void SeedGame(GameState *game, uint32_t seed);        // Restart the RNG from seed (before the first tick)
+void AttachReplay(GameState *game, Replay *replay);   // Record / play back ticks from now on (seeds the game for playback)
+uint32_t ChecksumGame(const GameState *game);         // Hash of the simulated state (not render caches)
+void SaveGameSnapshot(const GameState *game, Snapshot *snapshot);     // Copy the simulated state (and its checksum)
+bool RestoreGameSnapshot(GameState *game, const Snapshot *snapshot);  // Put a saved state back (false if it can't be read or doesn't match its checksum)
+void KeepGameHistory(GameState *game, bool keep);     // Snapshot every tick from now on (or stop)
+int RewindGame(GameState *game, int ticks);           // Go back up to ticks ticks in the history (returns how many)
+void AdvanceGame(GameState *game, float frameTime);   // Run the ticks a frame's worth of time calls for
+void UpdateGame(GameState *game, float delta);        // One simulation tick (delta is SIM_DT when called from AdvanceGame)
 void RenderGame(GameState *game);                     // Render/draw game graphics
 void CleanupGame(GameState *game);                    // Clean up resources
 
@@ -0,0 +1,102 @@
+#include "headless.h"
+#include <stdio.h>
+#include <time.h>
+
+// Wall clock in seconds (raylib's GetTime needs a window)
+static double wall_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Fresh level and play state - driven by the bot, or by the replay when one is given
+static void start_run(GameState *game, const HeadlessOptions *options, InputBot *bot, Replay *replay, int run) {
+    InitGame(game, options->mapPath);
+    game->inputSource = BotInput(bot);
+    SeedGame(game, options->seed + run);
+    if (replay) AttachReplay(game, replay);
+}
+
+int RunHeadless(const HeadlessOptions *options) {
+    SetTraceLogLevel(LOG_WARNING);  // Per-file INFO lines would drown the report
+    SetHeadlessAssets(true);
+
+    Replay replay;
+    bool replaying = options->replayPath != NULL;
+    bool recording = !replaying && options->recordPath != NULL;
+    if (replaying && !LoadReplay(&replay, options->replayPath, SIM_TICK_RATE)) {
+        printf("Could not read replay %s\n", options->replayPath);
+        return 1;
+    }
+
+    if (!PreloadGameAssets()) {
+        printf("Could not load the sprites or animations\n");
+        if (replaying) CloseReplay(&replay);
+        UnloadAllTextures();
+        return 1;
+    }
+    InputBot bot;
+    InitInputBot(&bot, options->seed);
+    GameState game;
+    start_run(&game, options, &bot, replaying ? &replay : NULL, 0);
+    if (recording) {
+        if (!StartReplayRecording(&replay, options->recordPath, options->mapPath, game.seed, SIM_TICK_RATE)) {
+            printf("Could not write replay %s\n", options->recordPath);
+            CleanupGame(&game);
+            UnloadGameAssets();
+            UnloadAllTextures();
+            return 1;
+        }
+        AttachReplay(&game, &replay);
+    }
+
+    // Only ticks are timed - restarts reload the level, which is not what's being measured
+    long ticks = 0, slowestTick = 0;
+    int wins = 0, deaths = 0;
+    double simulated = 0.0, slowest = 0.0;
+    while (replaying ? !IsReplayFinished(&replay) : ticks < options->ticks) {
+        double start = wall_seconds();
+        AdvanceGame(&game, SIM_DT);  // Exactly one tick (and one input sample) per call
+        double elapsed = wall_seconds() - start;
+        simulated += elapsed;
+        if (elapsed > slowest) {
+            slowest = elapsed;
+            slowestTick = ticks;
+        }
+        ticks++;
+
+        // A replay carries on past game over (so did the game it was recorded from)
+        if (game.sim.gameOver && !replaying) {
+            if (game.sim.playerWon) wins++;
+            else deaths++;
+            if (recording) break;
+            CleanupGame(&game);
+            start_run(&game, options, &bot, NULL, wins + deaths);
+        }
+    }
+
+    printf("%ld ticks (%.1f s of game time) in %.3f s: %.0f ticks/s, %.2f us/tick\n",
+           ticks, ticks * SIM_DT, simulated,
+           simulated > 0 ? ticks / simulated : 0.0,
+           ticks ? simulated * 1e6 / ticks : 0.0);
+    printf("Slowest tick: %ld (%.1f us)\n", slowestTick, slowest * 1e6);
+
+    int result = 0;
+    if (replaying) {
+        if (replay.divergedAt >= 0) {
+            printf("Replay diverged at tick %ld of %ld\n", replay.divergedAt, replay.tickCount);
+            result = 2;
+        } else {
+            printf("Replay matched all %ld ticks (seed %u)\n", replay.tickCount, replay.header.seed);
+        }
+    } else {
+        printf("%d runs ended: %d won, %d died (seed %u)\n", wins + deaths, wins, deaths, options->seed);
+        if (recording) printf("Recorded %ld ticks to %s\n", replay.tickCount, options->recordPath);
+    }
+
+    if (replaying || recording) CloseReplay(&replay);
+    CleanupGame(&game);
+    UnloadGameAssets();
+    UnloadAllTextures();
+    return result;
+}
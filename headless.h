@@ -0,0 +1,31 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+// Include necessary libraries
+#include "game.h"  // Simulation being run
+
+/*
+    Headless run (ManaRush <map> --headless [--ticks N] [--seed N] [--record file | --replay file])
+    Runs the simulation with no window, GL context or audio device, as fast as the CPU allows:
+        -map and sprite metadata load as usual (textures keep only their sizes)
+        -a seeded bot plays, and the level restarts whenever a run ends
+        -with --record the bot's first run is recorded and the session ends with it
+        -with --replay a recording plays instead of the bot, checksums are compared every tick
+        -prints ticks per second, the slowest tick and how the runs ended
+    For soak tests and gameplay benchmarks on machines without a display. Replays are the fixed
+    workload for comparing builds and chasing a slow tick.
+*/
+#define HEADLESS_DEFAULT_TICKS (SIM_TICK_RATE * 600)  // Ten minutes of game time
+
+typedef struct HeadlessOptions {
+    const char *mapPath;
+    long ticks;               // Ticks to simulate, across restarts (a replay runs to its end instead)
+    unsigned int seed;        // Bot and game seed (same seed, same runs)
+    const char *recordPath;   // Record the first run here (NULL = don't)
+    const char *replayPath;   // Play this recording instead of the bot (NULL = bot)
+} HeadlessOptions;
+
+// Function declarations - headless run
+int RunHeadless(const HeadlessOptions *options);   // Returns the process exit code (2 = replay diverged)
+
+#endif
@@ -0,0 +1,71 @@
+#include "hot_reload.h"
+#include <stdio.h>
+#include <string.h>
+
+void InitHotReload(HotReload *reload, const char *levelPath) {
+    strncpy(reload->levelPath, levelPath, sizeof(reload->levelPath) - 1);
+    reload->levelPath[sizeof(reload->levelPath) - 1] = '\0';
+    InitFileWatch(&reload->watch);
+    WatchFile(&reload->watch, reload->levelPath);
+}
+
+// Add every file-backed texture in the cache (tilesets and atlas pages show up as they load)
+static void watch_textures(HotReload *reload) {
+    for (AssetHandle handle = 1; handle <= MAX_TEXTURE_ASSETS; handle++) {
+        const char *path = GetTexturePath(handle);
+        if (path && FileExists(path)) WatchFile(&reload->watch, path);
+    }
+}
+
+// Is path one of the level's tileset images
+static bool is_level_image(const Level *level, const char *path) {
+    for (int i = 0; i < level->header->imageCount; i++) {
+        char imagePath[ASSET_PATH_LENGTH];
+        GetLevelImagePath(level, i, imagePath, sizeof(imagePath));
+        if (strcmp(imagePath, path) == 0) return true;
+    }
+    return false;
+}
+
+void UpdateHotReload(HotReload *reload, GameState *game, LevelLoader *loader) {
+    // Pick up textures loaded since the last check
+    if (GetTime() >= reload->watch.nextCheck) watch_textures(reload);
+
+    const char *changed[HOT_RELOAD_MAX_CHANGES];
+    int count = PollFileWatch(&reload->watch, changed, HOT_RELOAD_MAX_CHANGES);
+    if (count == 0) return;
+
+    double start = GetTime();
+    const Level *level = game ? &game->level : GetLoadingLevel(loader);  // Whose tilesets count
+    bool levelChanged = false, tilesetChanged = false;
+    for (int i = 0; i < count; i++) {
+        if (strcmp(changed[i], reload->levelPath) == 0) {
+            levelChanged = true;
+        } else if (ReloadTextureFile(changed[i])) {
+            if (level && is_level_image(level, changed[i])) tilesetChanged = true;
+            printf("Hot reload: %s\n", changed[i]);
+        }
+    }
+
+    if (!game) {
+        // Menu: what the loader prepared is only stale if the map or one of its tilesets changed
+        // (other textures, like the menu background, were already reloaded in place)
+        if (levelChanged || tilesetChanged) {
+            CancelLevelLoad(loader);
+            StartLevelLoad(loader, reload->levelPath);
+        }
+        return;
+    }
+    if (levelChanged) {
+        if (ReloadGameLevel(game, reload->levelPath)) {
+            printf("Hot reload: %s (%.1f ms)\n", reload->levelPath, (GetTime() - start) * 1000.0);
+        } else {
+            printf("Hot reload: %s failed to load, keeping the current level\n", reload->levelPath);
+        }
+    }
+    if (tilesetChanged) MarkMapCacheDirty(&game->mapCache);
+}
+
+void FreeHotReload(HotReload *reload) {
+    FreeFileWatch(&reload->watch);
+}
@@ -0,0 +1,29 @@
+#ifndef HOT_RELOAD_H
+#define HOT_RELOAD_H
+
+// Include necessary libraries
+#include "game.h"          // Game whose level is swapped
+#include "level_loader.h"  // Menu-time load restarted on changes
+#include "file_watch.h"    // Change notification
+
+/*
+    Hot reload (ManaRush <map> --watch)
+    Watches the map file and every texture file in the asset cache while the game runs:
+        -map saved      -> ReloadGameLevel, play state kept, only edited chunks rebaked
+        -texture saved  -> reloaded in place, tileset edits rebake the baked chunks
+        -in the menu    -> the background load starts over if the map or one of its tilesets changed
+    Keep a .mrmap next to its .tmx and rerun MapCompiler to pick up edits, or run the .tmx directly.
+*/
+#define HOT_RELOAD_MAX_CHANGES 16    // Files handled per poll (the rest wait for the next one)
+
+typedef struct HotReload {
+    char levelPath[LEVEL_PATH_LENGTH];
+    FileWatch watch;
+} HotReload;
+
+// Function declarations - hot reload
+void InitHotReload(HotReload *reload, const char *levelPath);
+void UpdateHotReload(HotReload *reload, GameState *game, LevelLoader *loader); // game is NULL while the menu is up
+void FreeHotReload(HotReload *reload);
+
+#endif
@@ -0,0 +1,59 @@
+#include "hud.h"
+#include <stdio.h>
+
+// Render a HUD box: dark background, white border, text with a 1px black shadow
+static void build_panel(UiPanel *panel, const UiText *text, int x, int y, Color textColor) {
+    float width = text->size.x + HUD_PADDING * 2;
+    float height = text->size.y + HUD_PADDING * 2;
+
+    BeginUiPanel(panel, x - HUD_PADDING, y - HUD_PADDING, width, height);
+    DrawRectangle(0, 0, (int)width, (int)height, (Color){0, 0, 0, 230});
+    DrawRectangleLines(0, 0, (int)width, (int)height, WHITE);
+    DrawUiText(text, (Vector2){HUD_PADDING + 1, HUD_PADDING + 1}, BLACK);
+    DrawUiText(text, (Vector2){HUD_PADDING, HUD_PADDING}, textColor);
+    EndUiPanel(panel);
+}
+
+void InitHud(Hud *hud) {
+    *hud = (Hud){0};
+    hud->playerPanel.dirty = true;
+    hud->bossPanel.dirty = true;
+}
+
+void UpdateHud(Hud *hud, const Health *player, const Health *boss, bool bossDead) {
+    // raylib's default font draws with spacing fontSize / 10
+    Font font = GetFontDefault();
+    char buffer[UI_TEXT_LENGTH];
+
+    // PLAYER HUD: Always show
+    if (hud->playerPanel.dirty || player->current != hud->playerHealth) {
+        hud->playerHealth = player->current;
+        snprintf(buffer, sizeof(buffer), "Player HP: %d / %d", player->current, player->max);
+        SetUiText(&hud->playerText, font, HUD_FONT_SIZE, HUD_FONT_SIZE / 10, buffer);
+        build_panel(&hud->playerPanel, &hud->playerText, HUD_X, HUD_PLAYER_Y, GREEN);
+    }
+
+    /*
+        BOSS HUD: Always show even when dead
+            Alive -> current health in red
+            Dead -> DEFEATED in gray
+    */
+    if (hud->bossPanel.dirty || boss->current != hud->bossHealth || bossDead != hud->bossDead) {
+        hud->bossHealth = boss->current;
+        hud->bossDead = bossDead;
+        if (!bossDead) snprintf(buffer, sizeof(buffer), "Boss HP: %d / %d", boss->current, boss->max);
+        else snprintf(buffer, sizeof(buffer), "Boss: DEFEATED");
+        SetUiText(&hud->bossText, font, HUD_FONT_SIZE, HUD_FONT_SIZE / 10, buffer);
+        build_panel(&hud->bossPanel, &hud->bossText, HUD_X, HUD_BOSS_Y, bossDead ? GRAY : RED);
+    }
+}
+
+void DrawHud(const Hud *hud) {
+    DrawUiPanel(&hud->playerPanel);
+    DrawUiPanel(&hud->bossPanel);
+}
+
+void UnloadHud(Hud *hud) {
+    UnloadUiPanel(&hud->playerPanel);
+    UnloadUiPanel(&hud->bossPanel);
+}
@@ -0,0 +1,33 @@
+#ifndef HUD_H
+#define HUD_H
+
+// Include necessary libraries
+#include "raylib.h"     // Raylib graphics
+#include "ui.h"         // Cached text and panels
+#include "ecs.h"        // Health components
+
+// HUD layout constants
+#define HUD_X 10             // X position from left edge
+#define HUD_PLAYER_Y 10      // Player HUD Y position
+#define HUD_BOSS_Y 40        // Boss HUD Y position (below player HUD)
+#define HUD_FONT_SIZE 20
+#define HUD_PADDING 8
+
+// Screen-space health readouts. Each panel is rebuilt only when the value it shows changes
+typedef struct Hud {
+    UiPanel playerPanel;
+    UiPanel bossPanel;
+    UiText playerText;
+    UiText bossText;
+    int playerHealth;    // Values the panels were last built from
+    int bossHealth;
+    bool bossDead;
+} Hud;
+
+// Function declarations - HUD
+void InitHud(Hud *hud);                                             // Mark both panels for building
+void UpdateHud(Hud *hud, const Health *player, const Health *boss, bool bossDead); // Rebuild changed panels (outside BeginMode2D)
+void DrawHud(const Hud *hud);                                       // Draw both panels in screen space
+void UnloadHud(Hud *hud);                                           // Free panel textures
+
+#endif
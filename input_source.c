@@ -0,0 +1,43 @@
+#include "input_source.h"
+
+// Keyboard - held keys are read now, presses are added to the ones not used yet
+static void sample_keyboard(void *data, CharacterInput *input) {
+    input->left = IsKeyDown(KEY_A);
+    input->right = IsKeyDown(KEY_D);
+    input->jump |= IsKeyPressed(KEY_SPACE);
+    input->shoot |= IsKeyPressed(KEY_E);
+}
+
+InputSource KeyboardInput(void) {
+    return (InputSource){ sample_keyboard, NULL };
+}
+
+void InitInputBot(InputBot *bot, unsigned int seed) {
+    SeedRng(&bot->rng, seed);
+    bot->direction = 0;
+    bot->holdTicks = 0;
+}
+
+// Walks in random stretches (mostly towards the boss on the right), jumps and shoots now and then
+static void sample_bot(void *data, CharacterInput *input) {
+    InputBot *bot = data;
+    if (bot->holdTicks <= 0) {
+        int roll = RngRange(&bot->rng, 10);
+        bot->direction = roll < 6 ? 1 : roll < 8 ? -1 : 0;
+        bot->holdTicks = INPUT_BOT_MIN_HOLD + RngRange(&bot->rng, INPUT_BOT_MAX_HOLD - INPUT_BOT_MIN_HOLD + 1);
+    }
+    bot->holdTicks--;
+
+    input->left = bot->direction < 0;
+    input->right = bot->direction > 0;
+    input->jump |= RngRange(&bot->rng, INPUT_BOT_JUMP_CHANCE) == 0;
+    input->shoot |= RngRange(&bot->rng, INPUT_BOT_SHOOT_CHANCE) == 0;
+}
+
+InputSource BotInput(InputBot *bot) {
+    return (InputSource){ sample_bot, bot };
+}
+
+void SampleInput(InputSource *source, CharacterInput *input) {
+    source->sample(source->data, input);
+}
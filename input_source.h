@@ -0,0 +1,40 @@
+#ifndef INPUT_SOURCE_H
+#define INPUT_SOURCE_H
+
+// Include necessary libraries
+#include "character.h"  // CharacterInput the sources fill
+#include "rng.h"        // Bot decisions
+
+/*
+    Where the player's controls come from
+    The simulation only ever sees CharacterInput, so it can be driven by:
+        -the keyboard (the normal game)
+        -a bot (headless soak tests and benchmarks - no window, so no keyboard)
+    sample() is called once per AdvanceGame: it sets the held controls and ORs presses in,
+    keeping presses a tick hasn't used yet.
+*/
+typedef struct InputSource {
+    void (*sample)(void *data, CharacterInput *input);
+    void *data;          // Source state (NULL for the keyboard)
+} InputSource;
+
+// Bot tuning (in ticks of the fixed-step simulation)
+#define INPUT_BOT_MIN_HOLD 30      // Shortest time a direction is held
+#define INPUT_BOT_MAX_HOLD 180     // Longest time a direction is held
+#define INPUT_BOT_JUMP_CHANCE 90   // 1 in N ticks presses jump
+#define INPUT_BOT_SHOOT_CHANCE 20  // 1 in N ticks presses shoot
+
+// Random but reproducible player - the same seed always plays the same way
+typedef struct InputBot {
+    Rng rng;
+    int direction;       // -1 left, 0 standing, 1 right
+    int holdTicks;       // Samples left before picking a new direction
+} InputBot;
+
+// Function declarations - input sources
+InputSource KeyboardInput(void);                        // A / D move, SPACE jumps, E shoots
+void InitInputBot(InputBot *bot, unsigned int seed);
+InputSource BotInput(InputBot *bot);                    // The bot has to outlive the source
+void SampleInput(InputSource *source, CharacterInput *input);
+
+#endif
@@ -0,0 +1,257 @@
+#include "jobs.h"
+#include "raylib.h"  // TraceLog
+#include <string.h>
+
+#define JOB_IDLE_SPINS 64         // Empty looks at the deques before a worker goes to sleep
+
+// One batch of one job
+typedef struct JobTask {
+    JobGraph *graph;
+    int job;
+    int begin, end;
+} JobTask;
+
+/*
+    Per-thread deque behind a spin lock - the owner pushes and pops at the bottom, thieves take
+    from the top. Batches are coarse (hundreds of items), so the lock is rarely contended.
+    Index 0 belongs to whichever thread is not a worker (the game loop)
+*/
+typedef struct JobQueue {
+    AtomicInt lock;
+    int top, bottom;              // Live tasks are [top, bottom), positions wrap around the ring
+    JobTask tasks[JOB_QUEUE_SIZE];
+} JobQueue;
+
+typedef struct JobSystem {
+    Thread threads[JOB_MAX_WORKERS];
+    JobQueue queues[JOB_MAX_WORKERS + 1];
+    int workerCount;
+    AtomicInt running;            // Cleared to stop the workers
+    AtomicInt posted;             // Bumped whenever work is pushed (sleepers wait for a change)
+    WaitPoint wake;
+} JobSystem;
+
+static JobSystem jobSystem;
+static THREAD_LOCAL int queueIndex;  // This thread's deque (0 unless it is a worker)
+
+static void lock_queue(JobQueue *queue) {
+    while (!AtomicCompareExchange(&queue->lock, 0, 1)) {}
+}
+
+static void unlock_queue(JobQueue *queue) {
+    AtomicStore(&queue->lock, 0);
+}
+
+static bool push_task(JobQueue *queue, JobTask task) {
+    lock_queue(queue);
+    bool pushed = queue->bottom - queue->top < JOB_QUEUE_SIZE;
+    if (pushed) queue->tasks[queue->bottom++ % JOB_QUEUE_SIZE] = task;
+    unlock_queue(queue);
+    return pushed;
+}
+
+// Newest task of our own deque
+static bool pop_task(JobQueue *queue, JobTask *task) {
+    lock_queue(queue);
+    bool popped = queue->bottom > queue->top;
+    if (popped) *task = queue->tasks[--queue->bottom % JOB_QUEUE_SIZE];
+    if (queue->top == queue->bottom) queue->top = queue->bottom = 0;  // Empty - restart so positions never overflow
+    unlock_queue(queue);
+    return popped;
+}
+
+// Oldest task of someone else's deque
+static bool steal_task(JobQueue *queue, JobTask *task) {
+    lock_queue(queue);
+    bool stolen = queue->bottom > queue->top;
+    if (stolen) *task = queue->tasks[queue->top++ % JOB_QUEUE_SIZE];
+    if (queue->top == queue->bottom) queue->top = queue->bottom = 0;
+    unlock_queue(queue);
+    return stolen;
+}
+
+// Own deque first, then the others starting after ours (spreads thieves out)
+static bool find_task(JobTask *task) {
+    int queues = jobSystem.workerCount + 1;
+    if (pop_task(&jobSystem.queues[queueIndex], task)) return true;
+    for (int i = 1; i < queues; i++) {
+        if (steal_task(&jobSystem.queues[(queueIndex + i) % queues], task)) return true;
+    }
+    return false;
+}
+
+static void run_task(JobTask task);
+
+// A job's dependencies are done - cut it into batches on this thread's deque
+static void schedule_job(JobGraph *graph, int id) {
+    Job *job = &graph->jobs[id];
+    int count = *job->count > 0 ? *job->count : 0;
+    int batches = (count + job->batchSize - 1) / job->batchSize;
+    if (batches == 0) {
+        // Nothing to do - finish it as an empty batch so its dependents still run
+        AtomicStore(&job->batchesLeft, 1);
+        run_task((JobTask){ graph, id, 0, 0 });
+        return;
+    }
+
+    AtomicStore(&job->batchesLeft, batches);
+    JobQueue *queue = &jobSystem.queues[queueIndex];
+    for (int b = batches - 1; b >= 0; b--) {   // Pushed last to first, so batch 0 pops first
+        int begin = b * job->batchSize;
+        int end = begin + job->batchSize < count ? begin + job->batchSize : count;
+        JobTask task = { graph, id, begin, end };
+        if (!push_task(queue, task)) run_task(task);  // Deque full - just do it now
+    }
+    // Sleepers are only woken for real parallel work - a single batch goes to whoever is awake
+    // (at worst the thread that pushed it)
+    if (jobSystem.workerCount > 0 && batches > 1) {
+        AtomicAdd(&jobSystem.posted, 1);
+        WakeWaiters(&jobSystem.wake);
+    }
+}
+
+// Run one batch; the last batch of a job releases the jobs waiting on it
+static void run_task(JobTask task) {
+    JobGraph *graph = task.graph;
+    Job *job = &graph->jobs[task.job];
+    if (task.end > task.begin) job->function(job->data, task.begin, task.end);
+    if (AtomicAdd(&job->batchesLeft, -1) != 0) return;
+
+    for (int i = 0; i < job->dependentCount; i++) {
+        int dependent = job->dependents[i];
+        if (AtomicAdd(&graph->jobs[dependent].waitingOn, -1) == 0) schedule_job(graph, dependent);
+    }
+    AtomicAdd(&graph->jobsLeft, -1);  // After the dependents are out, so the graph can't look done early
+}
+
+// Worker: run batches, sleep when there have been none for a while
+static void worker_main(void *arg) {
+    queueIndex = (int)(size_t)arg;
+    while (AtomicLoad(&jobSystem.running)) {
+        JobTask task;
+        int seen = AtomicLoad(&jobSystem.posted);
+        bool found = false;
+        for (int spin = 0; spin < JOB_IDLE_SPINS && !found; spin++) {
+            found = find_task(&task);
+            if (!found) YieldThread();
+        }
+        if (found) run_task(task);
+        else WaitForChange(&jobSystem.wake, &jobSystem.posted, seen);
+    }
+}
+
+void InitJobSystem(int workers) {
+    memset(&jobSystem, 0, sizeof(jobSystem));
+    if (workers < 0) workers = GetCpuCount() - 1;
+    if (workers > JOB_MAX_WORKERS) workers = JOB_MAX_WORKERS;
+    if (workers == 0) return;
+    if (!InitWaitPoint(&jobSystem.wake)) {
+        TraceLog(LOG_WARNING, "JOBS: Could not set up the wake signal, running jobs on the main thread");
+        return;
+    }
+
+    // Set before any worker runs (they read it) - a worker that fails to start just leaves an
+    // empty deque behind
+    AtomicStore(&jobSystem.running, 1);
+    jobSystem.workerCount = workers;
+    int started = 0;
+    for (int i = 0; i < workers; i++) {
+        if (StartThread(&jobSystem.threads[i], worker_main, (void *)(size_t)(i + 1))) started++;
+    }
+    if (started == 0) {
+        // No threads at all - back to running everything on the main thread
+        TraceLog(LOG_WARNING, "JOBS: Could not start any workers, running jobs on the main thread");
+        AtomicStore(&jobSystem.running, 0);
+        FreeWaitPoint(&jobSystem.wake);
+        jobSystem.workerCount = 0;
+    } else if (started < workers) {
+        TraceLog(LOG_WARNING, "JOBS: Could only start %d of %d workers", started, workers);
+    } else {
+        TraceLog(LOG_INFO, "JOBS: %d worker threads", workers);
+    }
+}
+
+void ShutdownJobSystem(void) {
+    if (jobSystem.workerCount == 0) return;
+    AtomicStore(&jobSystem.running, 0);
+    AtomicAdd(&jobSystem.posted, 1);
+    WakeWaiters(&jobSystem.wake);
+    for (int i = 0; i < jobSystem.workerCount; i++) JoinThread(&jobSystem.threads[i]);
+    FreeWaitPoint(&jobSystem.wake);
+    jobSystem.workerCount = 0;
+}
+
+int GetJobWorkerCount(void) {
+    return jobSystem.workerCount;
+}
+
+void ClearJobGraph(JobGraph *graph) {
+    graph->jobCount = 0;
+}
+
+int AddDeferredJob(JobGraph *graph, JobFunction function, void *data, const int *count, int batchSize) {
+    if (graph->jobCount >= JOB_GRAPH_MAX_JOBS) {
+        TraceLog(LOG_ERROR, "JOBS: More than %d jobs in one graph", JOB_GRAPH_MAX_JOBS);
+        return -1;
+    }
+    int id = graph->jobCount++;
+    Job *job = &graph->jobs[id];
+    job->function = function;
+    job->data = data;
+    job->count = count;
+    job->batchSize = batchSize > 0 ? batchSize : 1;
+    AtomicStore(&job->waitingOn, 0);
+    job->dependentCount = 0;
+    return id;
+}
+
+int AddJob(JobGraph *graph, JobFunction function, void *data, int count, int batchSize) {
+    int id = AddDeferredJob(graph, function, data, NULL, batchSize);
+    if (id < 0) return id;
+    Job *job = &graph->jobs[id];
+    job->fixedCount = count;
+    job->count = &job->fixedCount;
+    return id;
+}
+
+void AddJobDependency(JobGraph *graph, int before, int after) {
+    if (before < 0 || after < 0) return;
+    Job *job = &graph->jobs[before];
+    if (job->dependentCount >= JOB_MAX_DEPENDENTS) {
+        TraceLog(LOG_ERROR, "JOBS: More than %d jobs wait on one job", JOB_MAX_DEPENDENTS);
+        return;
+    }
+    job->dependents[job->dependentCount++] = after;
+    AtomicAdd(&graph->jobs[after].waitingOn, 1);
+}
+
+/*
+    Put out every job that waits on nothing, then work (or steal) until the whole graph is done.
+    Jobs of other graphs may run here meanwhile - fine, since they would be run by someone anyway
+*/
+void RunJobGraph(JobGraph *graph) {
+    // Roots are picked before any is scheduled - a finished root releases its dependents itself
+    int roots[JOB_GRAPH_MAX_JOBS], rootCount = 0;
+    for (int id = 0; id < graph->jobCount; id++) {
+        if (AtomicLoad(&graph->jobs[id].waitingOn) == 0) roots[rootCount++] = id;
+    }
+    AtomicStore(&graph->jobsLeft, graph->jobCount);
+    for (int i = 0; i < rootCount; i++) schedule_job(graph, roots[i]);
+    while (AtomicLoad(&graph->jobsLeft) > 0) {
+        JobTask task;
+        if (find_task(&task)) run_task(task);
+        else YieldThread();   // The last batches are running on other threads
+    }
+}
+
+void ParallelFor(JobFunction function, void *data, int count, int batchSize) {
+    if (count <= 0) return;
+    if (count <= batchSize) {
+        function(data, 0, count);  // One batch - not worth a trip through the deques
+        return;
+    }
+    JobGraph graph;
+    ClearJobGraph(&graph);
+    AddJob(&graph, function, data, count, batchSize);
+    RunJobGraph(&graph);
+}
@@ -0,0 +1,54 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+#include "thread.h"   // Threads, atomics, sleeping
+
+// Job system constants
+#define JOB_MAX_WORKERS 15        // Worker threads at most (the thread running a graph helps too)
+#define JOB_QUEUE_SIZE 1024       // Batches one thread's deque holds (a full deque runs batches inline)
+#define JOB_GRAPH_MAX_JOBS 16     // Jobs in one graph
+#define JOB_MAX_DEPENDENTS 4      // Jobs that can wait on one job
+
+// Work for items [begin, end) of a job
+typedef void (*JobFunction)(void *data, int begin, int end);
+
+// One parallel-for: count items cut into batches, run once everything it waits on is done
+typedef struct Job {
+    JobFunction function;
+    void *data;
+    const int *count;             // Items - read when the job becomes ready, so earlier jobs can decide it
+    int fixedCount;               // What count points at for AddJob
+    int batchSize;                // Items per batch (one thread runs a whole batch)
+    AtomicInt batchesLeft;        // Until the job is done
+    AtomicInt waitingOn;          // Unfinished jobs it depends on
+    int dependents[JOB_MAX_DEPENDENTS];
+    int dependentCount;
+} Job;
+
+/*
+    Job graph - jobs plus "runs after" edges, run to completion by RunJobGraph
+    Jobs whose dependencies are done go out as batches to per-thread deques. A thread pops its own
+    newest batch first (cache-warm) and, when its deque is empty, steals the oldest batch of
+    another thread. Batches only write their own items, so results don't depend on which thread
+    ran what; anything that has to be combined is merged by a later job in a fixed order.
+*/
+typedef struct JobGraph {
+    Job jobs[JOB_GRAPH_MAX_JOBS];
+    int jobCount;
+    AtomicInt jobsLeft;           // Until the graph is done
+} JobGraph;
+
+// Function declarations - job system (one per process)
+void InitJobSystem(int workers);      // Start workers (< 0 = one per core minus this thread, 0 = everything inline)
+void ShutdownJobSystem(void);         // Stop and join the workers
+int GetJobWorkerCount(void);
+
+// Function declarations - job graphs
+void ClearJobGraph(JobGraph *graph);
+int AddJob(JobGraph *graph, JobFunction function, void *data, int count, int batchSize);              // Job id
+int AddDeferredJob(JobGraph *graph, JobFunction function, void *data, const int *count, int batchSize); // Same, count read when ready
+void AddJobDependency(JobGraph *graph, int before, int after);                                          // after waits for before
+void RunJobGraph(JobGraph *graph);    // Run every job and return when all are done (the caller works too)
+void ParallelFor(JobFunction function, void *data, int count, int batchSize); // One-job graph (inline if it's one batch)
+
+#endif
@@ -0,0 +1,430 @@
+#include "level.h"
+#include "collision.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+//========================
+//      Compiler
+//========================
+
+// Growable byte buffer the level blob is assembled in
+typedef struct BlobWriter {
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+    bool failed;             // Ran out of memory - nothing more is appended
+} BlobWriter;
+
+// Append bytes (zeros if src is NULL) at the next multiple of alignment and return their offset
+static uint64_t blob_append_aligned(BlobWriter *blob, const void *src, size_t length, size_t alignment) {
+    if (blob->failed) return 0;
+    size_t offset = (blob->size + alignment - 1) & ~(alignment - 1);
+    if (offset + length > blob->capacity) {
+        size_t capacity = blob->capacity;
+        while (offset + length > capacity) capacity = capacity ? capacity * 2 : 4096;
+        uint8_t *data = realloc(blob->data, capacity);
+        if (!data) {
+            blob->failed = true;
+            return 0;
+        }
+        blob->data = data;
+        blob->capacity = capacity;
+    }
+    memset(blob->data + blob->size, 0, offset - blob->size);  // padding
+    if (src) memcpy(blob->data + offset, src, length);
+    else memset(blob->data + offset, 0, length);
+    blob->size = offset + length;
+    return offset;
+}
+
+// Append bytes at the next 8-byte boundary
+static uint64_t blob_append(BlobWriter *blob, const void *src, size_t length) {
+    return blob_append_aligned(blob, src, length, 8);
+}
+
+// Tile layers whose tiles block movement
+static bool is_collidable_layer(const char *name) {
+    return (strcmp(name, "platform") == 0 ||
+            strcmp(name, "bridge") == 0 ||
+            strcmp(name, "uw_plant") == 0);
+}
+
+// Check a bool property on a layer (missing = false)
+static bool layer_flag(tmx_layer *layer, const char *name) {
+    tmx_property *prop = tmx_get_property(layer->properties, name);
+    return prop && prop->type == PT_BOOL && prop->value.boolean;
+}
+
+// Copy a name into a fixed-size field (always terminated)
+static void copy_name(char *dst, const char *src, size_t size) {
+    strncpy(dst, src ? src : "", size - 1);
+    dst[size - 1] = '\0';
+}
+
+// libtmx image callback used while compiling: keep the resolved path instead of loading pixels
+static void *capture_image_path(const char *path) {
+    size_t length = strlen(path) + 1;
+    char *copy = malloc(length);
+    if (!copy) return NULL;  // libtmx fails the load
+    memcpy(copy, path, length);
+    return copy;
+}
+
+tmx_map *LoadTmxForCompile(const char *path) {
+    tmx_img_load_func = capture_image_path;
+    tmx_img_free_func = free;
+    tmx_map *map = tmx_load(path);
+    if (!map) tmx_perror("tmx_load");
+    return map;
+}
+
+// Find or add an image path, stored relative to the map directory (-1 if out of memory)
+static int32_t intern_image(BlobWriter *images, int32_t *count, const char *path, const char *mapDirectory) {
+    size_t dirLength = strlen(mapDirectory);
+    if (dirLength && strncmp(path, mapDirectory, dirLength) == 0) path += dirLength;
+    while (strncmp(path, "./", 2) == 0) path += 2;
+
+    LevelImage *list = (LevelImage *)images->data;
+    for (int i = 0; i < *count; i++) {
+        if (strcmp(list[i].path, path) == 0) return i;
+    }
+    LevelImage image;
+    copy_name(image.path, path, sizeof(image.path));
+    blob_append(images, &image, sizeof(image));
+    if (images->failed) return -1;
+    return (*count)++;
+}
+
+static void bind_level_sections(Level *level, const uint8_t *base);
+
+// Give up on a compile that ran out of memory
+static void *compile_failed(BlobWriter *blob) {
+    fprintf(stderr, "Level: out of memory compiling the level\n");
+    free(blob->data);
+    return NULL;
+}
+
+void *CompileLevel(tmx_map *map, const char *mapDirectory, size_t *size) {
+    BlobWriter blob = {0};
+    LevelHeader header = {0};
+    header.magic = LEVEL_MAGIC;
+    header.version = LEVEL_VERSION;
+    header.width = map->width;
+    header.height = map->height;
+    header.tileWidth = map->tile_width;
+    header.tileHeight = map->tile_height;
+    tmx_col_bytes bg = tmx_col_to_bytes(map->backgroundcolor);
+    memcpy(header.backgroundColor, &bg, 4);
+    blob_append(&blob, &header, sizeof(header));
+
+    // Tile layer records
+    for (tmx_layer *layer = map->ly_head; layer; layer = layer->next) {
+        if (layer->type == L_LAYER) header.layerCount++;
+    }
+    header.layersOffset = blob_append(&blob, NULL, header.layerCount * sizeof(LevelLayer));
+    if (blob.failed) return compile_failed(&blob);
+    int index = 0;
+    for (tmx_layer *layer = map->ly_head; layer; layer = layer->next) {
+        if (layer->type != L_LAYER) continue;
+        LevelLayer *out = (LevelLayer *)(blob.data + header.layersOffset) + index++;
+        copy_name(out->name, layer->name, sizeof(out->name));
+        out->flags = (layer->visible ? LEVEL_LAYER_VISIBLE : 0) |
+                     (layer_flag(layer, "background") ? LEVEL_LAYER_BACKGROUND : 0) |
+                     (layer_flag(layer, "foreground") ? LEVEL_LAYER_FOREGROUND : 0) |
+                     (is_collidable_layer(layer->name) ? LEVEL_LAYER_COLLIDABLE : 0);
+        out->opacity = (float)layer->opacity;
+        out->parallaxX = (float)layer->parallaxx;
+        out->parallaxY = (float)layer->parallaxy;
+
+        // Rows that hold tiles, so backgrounds size their strips without scanning the whole layer at load
+        out->firstRow = 0;
+        out->lastRow = -1;
+        for (int i = 0; i < (int)map->height; i++) {
+            for (int j = 0; j < (int)map->width; j++) {
+                if (layer->content.gids[(size_t)i * map->width + j] & TMX_FLIP_BITS_REMOVAL) {
+                    if (out->lastRow < 0) out->firstRow = i;
+                    out->lastRow = i;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Gid chunks - all layers of LEVEL_CHUNK_TILES columns side by side, each chunk on its own pages
+    header.chunkCount = (map->width + LEVEL_CHUNK_TILES - 1) / LEVEL_CHUNK_TILES;
+    size_t chunkBytes = (size_t)header.layerCount * map->height * LEVEL_CHUNK_TILES * sizeof(uint32_t);
+    header.chunkStride = ((chunkBytes ? chunkBytes : 1) + LEVEL_CHUNK_ALIGN - 1) & ~(uint64_t)(LEVEL_CHUNK_ALIGN - 1);
+    header.chunksOffset = blob_append_aligned(&blob, NULL, header.chunkStride * header.chunkCount, LEVEL_CHUNK_ALIGN);
+    if (blob.failed) return compile_failed(&blob);
+    for (int c = 0; c < header.chunkCount; c++) {
+        uint32_t *out = (uint32_t *)(blob.data + header.chunksOffset + c * header.chunkStride);
+        for (tmx_layer *layer = map->ly_head; layer; layer = layer->next) {
+            if (layer->type != L_LAYER) continue;
+            for (int i = 0; i < (int)map->height; i++) {
+                for (int j = 0; j < LEVEL_CHUNK_TILES; j++) {
+                    int x = c * LEVEL_CHUNK_TILES + j;
+                    *out++ = x < (int)map->width ? layer->content.gids[(size_t)i * map->width + x] : 0;
+                }
+            }
+        }
+    }
+
+    // Gid table - resolve tileset, image and source corner for every gid now instead of per draw
+    BlobWriter images = {0};
+    header.tileCount = map->tilecount;
+    header.tilesOffset = blob_append(&blob, NULL, header.tileCount * sizeof(LevelTile));
+    if (blob.failed) return compile_failed(&blob);
+    for (int gid = 0; gid < header.tileCount; gid++) {
+        LevelTile tile = { -1, 0, 0, 0, 0 };
+        tmx_tile *src = map->tiles[gid];
+        if (src) {
+            tmx_tileset *ts = src->tileset;
+            tmx_image *im = src->image ? src->image : ts->image;  // individual tile image : tileset
+            if (im && im->resource_image) {
+                tile.image = intern_image(&images, &header.imageCount, im->resource_image, mapDirectory);
+                tile.x = src->ul_x;
+                tile.y = src->ul_y;
+                tile.width = ts->tile_width;
+                tile.height = ts->tile_height;
+            }
+        }
+        ((LevelTile *)(blob.data + header.tilesOffset))[gid] = tile;
+    }
+    header.imagesOffset = blob_append(&blob, images.data, images.size);
+    free(images.data);
+    if (images.failed) blob.failed = true;
+
+    // Objects of every object layer (spawn points)
+    for (tmx_layer *layer = map->ly_head; layer; layer = layer->next) {
+        if (layer->type != L_OBJGR) continue;
+        for (tmx_object *obj = layer->content.objgr->head; obj; obj = obj->next) {
+            LevelObject object;
+            copy_name(object.layer, layer->name, sizeof(object.layer));
+            copy_name(object.name, obj->name, sizeof(object.name));
+            object.x = (float)obj->x;
+            object.y = (float)obj->y;
+            object.width = (float)obj->width;
+            object.height = (float)obj->height;
+            uint64_t offset = blob_append(&blob, &object, sizeof(object));
+            if (header.objectCount++ == 0) header.objectsOffset = offset;
+        }
+    }
+
+    // Collision bitmap - built through a view of what's been written so far
+    if (blob.failed) return compile_failed(&blob);
+    memcpy(blob.data, &header, sizeof(header));
+    Level partial = {0};
+    bind_level_sections(&partial, blob.data);
+    CollisionGrid grid;
+    BuildCollisionGrid(&grid, &partial);
+    if (!grid.bits) return compile_failed(&blob);
+    header.collisionWordsPerRow = grid.wordsPerRow;
+    header.collisionOffset = blob_append(&blob, grid.bits, (size_t)grid.wordsPerRow * grid.height * sizeof(uint32_t));
+    FreeCollisionGrid(&grid);
+    if (blob.failed) return compile_failed(&blob);
+
+    header.fileSize = blob.size;
+    memcpy(blob.data, &header, sizeof(header));
+    *size = blob.size;
+    return blob.data;
+}
+
+//========================
+//      Loader
+//========================
+
+// Point the section views at a blob (no validation)
+static void bind_level_sections(Level *level, const uint8_t *base) {
+    const LevelHeader *header = (const LevelHeader *)base;
+    level->header = header;
+    level->layers = (const LevelLayer *)(base + header->layersOffset);
+    level->images = (const LevelImage *)(base + header->imagesOffset);
+    level->tiles = (const LevelTile *)(base + header->tilesOffset);
+    level->objects = (const LevelObject *)(base + header->objectsOffset);
+    level->collisionBits = (const uint32_t *)(base + header->collisionOffset);
+}
+
+// Check that a section lies inside the blob
+static bool section_fits(uint64_t offset, uint64_t count, uint64_t elementSize, size_t size) {
+    return offset <= size && count <= (size - offset) / elementSize;
+}
+
+// Validate a blob and bind it - a bad or stale file is rejected instead of read out of bounds
+static bool bind_level(Level *level, const void *data, size_t size) {
+    const LevelHeader *header = data;
+    if (size < sizeof(LevelHeader) || header->magic != LEVEL_MAGIC) {
+        fprintf(stderr, "Level: not a compiled level\n");
+        return false;
+    }
+    if (header->version != LEVEL_VERSION || header->fileSize != size) {
+        fprintf(stderr, "Level: version %u / size mismatch - recompile with MapCompiler\n", header->version);
+        return false;
+    }
+
+    bool valid = header->width > 0 && header->height > 0 &&
+                 header->tileWidth > 0 && header->tileHeight > 0 &&
+                 section_fits(header->layersOffset, header->layerCount, sizeof(LevelLayer), size) &&
+                 section_fits(header->imagesOffset, header->imageCount, sizeof(LevelImage), size) &&
+                 section_fits(header->tilesOffset, header->tileCount, sizeof(LevelTile), size) &&
+                 section_fits(header->objectsOffset, header->objectCount, sizeof(LevelObject), size) &&
+                 header->collisionWordsPerRow == (header->width + 31) / 32 &&
+                 section_fits(header->collisionOffset, (uint64_t)header->collisionWordsPerRow * header->height, sizeof(uint32_t), size) &&
+                 header->chunkCount == (header->width + LEVEL_CHUNK_TILES - 1) / LEVEL_CHUNK_TILES &&
+                 header->chunksOffset % LEVEL_CHUNK_ALIGN == 0 &&
+                 header->chunkStride >= (uint64_t)header->layerCount * header->height * LEVEL_CHUNK_TILES * sizeof(uint32_t) &&
+                 header->chunkStride > 0 &&
+                 section_fits(header->chunksOffset, header->chunkCount, header->chunkStride, size);
+    if (valid) {
+        const LevelLayer *layers = (const LevelLayer *)((const uint8_t *)data + header->layersOffset);
+        for (int i = 0; i < header->layerCount && valid; i++) {
+            valid = layers[i].lastRow < header->height &&
+                    (layers[i].lastRow < 0 || (layers[i].firstRow >= 0 && layers[i].firstRow <= layers[i].lastRow));
+        }
+    }
+    if (valid) {
+        // Tiles index the images directly when drawn
+        const LevelTile *tiles = (const LevelTile *)((const uint8_t *)data + header->tilesOffset);
+        for (int i = 0; i < header->tileCount && valid; i++) {
+            valid = tiles[i].image >= -1 && tiles[i].image < header->imageCount;
+        }
+    }
+    if (!valid) {
+        fprintf(stderr, "Level: corrupt section table\n");
+        return false;
+    }
+
+    bind_level_sections(level, data);
+    return true;
+}
+
+// Does path end with suffix
+static bool has_extension(const char *path, const char *suffix) {
+    size_t length = strlen(path), suffixLength = strlen(suffix);
+    return length >= suffixLength && strcmp(path + length - suffixLength, suffix) == 0;
+}
+
+bool LoadLevel(Level *level, const char *path) {
+    *level = (Level){0};
+    level->residentLast = -1;  // Nothing asked for yet - the OS pages chunks in on first touch
+
+    // Directory part of the path (image paths are relative to it)
+    const char *slash = strrchr(path, '/');
+    const char *backslash = strrchr(path, '\\');
+    if (backslash > slash) slash = backslash;
+    size_t dirLength = slash ? (size_t)(slash - path + 1) : 0;
+    if (dirLength >= sizeof(level->directory)) dirLength = 0;
+    memcpy(level->directory, path, dirLength);
+    level->directory[dirLength] = '\0';
+
+    // Authoring path: parse the XML and compile in memory
+    if (has_extension(path, ".tmx")) {
+        tmx_map *map = LoadTmxForCompile(path);
+        if (!map) return false;
+        size_t size;
+        level->heapData = CompileLevel(map, level->directory, &size);
+        tmx_map_free(map);
+        if (!level->heapData) return false;
+        if (!bind_level(level, level->heapData, size)) {
+            free(level->heapData);
+            level->heapData = NULL;
+            return false;
+        }
+        return true;
+    }
+
+    // Compiled path: map the file and use it in place
+    if (!MapFile(&level->file, path)) {
+        fprintf(stderr, "Level: can't open %s\n", path);
+        return false;
+    }
+    if (!bind_level(level, level->file.data, level->file.size)) {
+        UnmapFile(&level->file);
+        return false;
+    }
+    return true;
+}
+
+void GetLevelImagePath(const Level *level, int image, char *path, size_t size) {
+    snprintf(path, size, "%s%s", level->directory, level->images[image].path);
+}
+
+// Tilesets stay resident across restarts, like the textures libtmx used to load
+bool LoadLevelTextures(Level *level) {
+    int count = level->header->imageCount;
+    level->textures = calloc(count ? count : 1, sizeof(AssetHandle));
+    if (!level->textures) {
+        fprintf(stderr, "Level: out of memory for %d tileset handles\n", count);
+        return false;
+    }
+    for (int i = 0; i < count; i++) {
+        char path[ASSET_PATH_LENGTH];
+        GetLevelImagePath(level, i, path, sizeof(path));
+        level->textures[i] = AcquireTexture(path);
+        KeepTextureResident(level->textures[i]);
+    }
+    return true;
+}
+
+void UnloadLevel(Level *level) {
+    if (level->textures) {
+        for (int i = 0; i < level->header->imageCount; i++) ReleaseTexture(level->textures[i]);
+        free(level->textures);
+    }
+    if (level->file.data) UnmapFile(&level->file);
+    free(level->heapData);
+    *level = (Level){0};
+}
+
+const uint32_t *GetLevelChunkGids(const Level *level, int chunk, int layer) {
+    const uint8_t *base = (const uint8_t *)level->header + level->header->chunksOffset + chunk * level->header->chunkStride;
+    return (const uint32_t *)base + (size_t)layer * level->header->height * LEVEL_CHUNK_TILES;
+}
+
+uint32_t GetLevelGid(const Level *level, int layer, int x, int y) {
+    if (x < 0 || y < 0 || x >= level->header->width || y >= level->header->height) return 0;
+    return GetLevelChunkGids(level, x / LEVEL_CHUNK_TILES, layer)[y * LEVEL_CHUNK_TILES + x % LEVEL_CHUNK_TILES];
+}
+
+// Tell the OS about a run of chunks of a mapped level (a level compiled in memory just stays resident)
+static void advise_chunks(const Level *level, int first, int last, bool needed) {
+    if (!level->file.data || first > last) return;
+    size_t offset = level->header->chunksOffset + (size_t)first * level->header->chunkStride;
+    AdviseMappedRange(&level->file, offset, (size_t)(last - first + 1) * level->header->chunkStride, needed);
+}
+
+/*
+    Only the chunks around the camera need to be in memory. Chunks leaving the range have their
+    pages dropped (they come back from the file if touched again), chunks entering it are read
+    ahead so the first bake that touches them doesn't stall on the disk.
+*/
+void SetLevelResidentChunks(Level *level, int first, int last) {
+    if (first < 0) first = 0;
+    if (last > level->header->chunkCount - 1) last = level->header->chunkCount - 1;
+
+    for (int c = level->residentFirst; c <= level->residentLast; c++) {
+        if (c < first || c > last) advise_chunks(level, c, c, false);
+    }
+    for (int c = first; c <= last; c++) {
+        if (c < level->residentFirst || c > level->residentLast) advise_chunks(level, c, c, true);
+    }
+    level->residentFirst = first;
+    level->residentLast = last;
+}
+
+Vector2 FindLevelSpawn(const Level *level, const char *layerName, Vector2 fallback) {
+    for (int i = 0; i < level->header->objectCount; i++) {
+        if (strcmp(level->objects[i].layer, layerName) == 0) {
+            return (Vector2){ level->objects[i].x, level->objects[i].y };
+        }
+    }
+    return fallback;
+}
+
+float GetLevelPixelWidth(const Level *level) {
+    return (float)level->header->width * level->header->tileWidth;
+}
+
+float GetLevelPixelHeight(const Level *level) {
+    return (float)level->header->height * level->header->tileHeight;
+}
@@ -0,0 +1,139 @@
+#ifndef LEVEL_H
+#define LEVEL_H
+
+// Include necessary libraries
+#include "raylib.h"       // Color / Vector2 types
+#include "tmx.h"          // Source maps the compiler reads
+#include "assets.h"       // Tileset textures live in the asset cache
+#include "mapped_file.h"  // Compiled levels are used straight from a file mapping
+#include <stdint.h>
+
+/*
+    Compiled level format
+    A .mrmap file is a LevelHeader followed by the sections it points to. Every section is a
+    plain array of the structs below, 8-byte aligned, so a mapped file is used in place with
+    no parsing. Little-endian only (same as every platform we ship on).
+    Tile gids are stored in column chunks (LEVEL_CHUNK_TILES wide, every layer and row of those
+    columns together, page aligned), so the pages of a chunk can be brought in or dropped on
+    their own and only the part of the level around the camera is ever resident.
+    The .tmx stays the authoring format - MapCompiler turns it into a .mrmap, and loading a
+    .tmx directly runs the same compiler in memory.
+*/
+#define LEVEL_MAGIC 0x50414D52u      // "RMAP" read as little-endian bytes
+#define LEVEL_VERSION 2              // Bump whenever a struct below changes
+#define LEVEL_NAME_LENGTH 32         // Layer / object name length
+#define LEVEL_PATH_LENGTH 256        // Image path length (relative to the level file)
+#define LEVEL_EXTENSION ".mrmap"     // Compiled level file extension
+#define LEVEL_CHUNK_TILES 64         // Columns per gid chunk
+#define LEVEL_CHUNK_ALIGN 4096       // Gid chunks start on a 4 KiB boundary (AdviseMappedRange rounds to larger pages)
+
+// Layer flags
+#define LEVEL_LAYER_VISIBLE    0x1   // Layer is drawn
+#define LEVEL_LAYER_BACKGROUND 0x2   // Parallax background ("background" property)
+#define LEVEL_LAYER_FOREGROUND 0x4   // Drawn over entities ("foreground" property)
+#define LEVEL_LAYER_COLLIDABLE 0x8   // Merged into the collision bitmap
+
+// File header - section offsets are from the start of the file
+typedef struct LevelHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t fileSize;               // Must match the file, catches truncated copies
+    int32_t width, height;           // Map size in tiles
+    int32_t tileWidth, tileHeight;   // Tile size in pixels
+    uint8_t backgroundColor[4];      // RGBA
+    int32_t layerCount;              // Tile layers, back to front
+    int32_t imageCount;              // Tileset images
+    int32_t tileCount;               // Entries in the gid table (max gid + 1)
+    int32_t objectCount;             // Objects from every object layer
+    int32_t collisionWordsPerRow;    // Collision bitmap row stride in 32-bit words
+    uint64_t layersOffset;
+    uint64_t imagesOffset;
+    uint64_t tilesOffset;
+    uint64_t objectsOffset;
+    uint64_t collisionOffset;        // height * collisionWordsPerRow words
+    int32_t chunkCount;              // Gid chunks, left to right
+    uint64_t chunkStride;            // Bytes from one chunk to the next (page multiple)
+    uint64_t chunksOffset;           // First chunk: [layer][row][LEVEL_CHUNK_TILES] gids, columns past the map are 0
+} LevelHeader;
+
+// Tile layer - its gids (TMX flip bits kept) are spread over the chunks
+typedef struct LevelLayer {
+    char name[LEVEL_NAME_LENGTH];
+    uint32_t flags;                  // LEVEL_LAYER_* bits
+    float opacity;
+    float parallaxX, parallaxY;      // Scroll factors (1 = moves with the world)
+    int32_t firstRow, lastRow;       // Rows holding tiles (lastRow -1 = empty layer)
+} LevelLayer;
+
+// Tileset image
+typedef struct LevelImage {
+    char path[LEVEL_PATH_LENGTH];
+} LevelImage;
+
+// Where a gid's pixels are - the tileset lookups libtmx does per tile, done once at compile time
+typedef struct LevelTile {
+    int32_t image;                   // Index into the images (-1 = no tile)
+    int32_t x, y;                    // Upper-left corner in the image
+    int32_t width, height;
+} LevelTile;
+
+// Object from an object layer (spawn points)
+typedef struct LevelObject {
+    char layer[LEVEL_NAME_LENGTH];   // Name of the object layer it came from
+    char name[LEVEL_NAME_LENGTH];
+    float x, y, width, height;
+} LevelObject;
+
+// Loaded level - views into one blob (mapped file or heap copy from a .tmx)
+typedef struct Level {
+    const LevelHeader *header;
+    const LevelLayer *layers;
+    const LevelImage *images;
+    const LevelTile *tiles;
+    const LevelObject *objects;
+    const uint32_t *collisionBits;
+    AssetHandle *textures;           // One per image, filled by LoadLevelTextures
+    char directory[LEVEL_PATH_LENGTH]; // Image paths are relative to this
+    MappedFile file;                 // Backing mapping (compiled levels)
+    void *heapData;                  // Backing memory (levels compiled from a .tmx at load)
+    int residentFirst, residentLast; // Gid chunks currently wanted in memory (see SetLevelResidentChunks)
+} Level;
+
+// Function declarations - level loading
+
+// Load a .mrmap (mapped in place) or a .tmx (compiled in memory). Returns false on a missing or invalid file
+bool LoadLevel(Level *level, const char *path);
+
+// Acquire the tileset textures (GPU work - kept apart from LoadLevel, which is safe to run on a worker thread).
+// Returns false if out of memory
+bool LoadLevelTextures(Level *level);
+
+// Release the textures and the level data
+void UnloadLevel(Level *level);
+
+// Compile a parsed TMX map into a level blob (malloc'd, NULL if out of memory). mapDirectory is stripped from image paths
+void *CompileLevel(tmx_map *map, const char *mapDirectory, size_t *size);
+
+// Parse a .tmx without loading any textures (image paths are kept for CompileLevel)
+tmx_map *LoadTmxForCompile(const char *path);
+
+// Full path of a tileset image (level directory + stored relative path)
+void GetLevelImagePath(const Level *level, int image, char *path, size_t size);
+
+// Gids of one layer in one chunk - rows of LEVEL_CHUNK_TILES entries
+const uint32_t *GetLevelChunkGids(const Level *level, int chunk, int layer);
+
+// Gid of a single tile (0 outside the map)
+uint32_t GetLevelGid(const Level *level, int layer, int x, int y);
+
+// Keep gid chunks first..last in memory - chunks leaving the range are dropped, new ones prefetched
+void SetLevelResidentChunks(Level *level, int first, int last);
+
+// Position of the first object in the named object layer (returns fallback if there is none)
+Vector2 FindLevelSpawn(const Level *level, const char *layerName, Vector2 fallback);
+
+// Level size in pixels
+float GetLevelPixelWidth(const Level *level);
+float GetLevelPixelHeight(const Level *level);
+
+#endif
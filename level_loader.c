@@ -0,0 +1,137 @@
+#include "level_loader.h"
+#include "game.h"  // Spawn camera the first bakes are made for
+#include <stdlib.h>
+#include <string.h>
+
+// Worker thread: all the CPU work - map parse / mapping, section checks, image decode
+static void load_worker(void *arg) {
+    LevelLoader *loader = arg;
+    if (!LoadLevel(&loader->level, loader->path)) {
+        AtomicStore(&loader->stage, LOADER_FAILED);
+        return;
+    }
+
+    int count = loader->level.header->imageCount;
+    loader->images = calloc(count ? count : 1, sizeof(Image));
+    loader->level.textures = calloc(count ? count : 1, sizeof(AssetHandle));
+    if (!loader->images || !loader->level.textures) {
+        free(loader->images);
+        free(loader->level.textures);
+        loader->images = NULL;
+        loader->level.textures = NULL;
+        UnloadLevel(&loader->level);
+        AtomicStore(&loader->stage, LOADER_FAILED);
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        char path[ASSET_PATH_LENGTH];
+        GetLevelImagePath(&loader->level, i, path, sizeof(path));
+        loader->images[i] = LoadImage(path);
+    }
+
+    // Release: everything written above is visible to the main thread once it sees UPLOADING
+    AtomicStore(&loader->stage, LOADER_UPLOADING);
+}
+
+// Bake toward the stream window of the spawn camera (the game starts from exactly that window)
+static int stream_spawn_area(LevelLoader *loader, int budget) {
+    Camera2D camera = GetSpawnCamera(&loader->level);
+    StreamWindow window = GetStreamWindow(&loader->level, camera, 0);
+    return StreamMapRenderCache(&loader->cache, &loader->level, camera, window, budget, false);
+}
+
+void StartLevelLoad(LevelLoader *loader, const char *path) {
+    LoaderStage stage = AtomicLoad(&loader->stage);
+    if (stage != LOADER_IDLE && stage != LOADER_FAILED) return;
+    CancelLevelLoad(loader);
+
+    strncpy(loader->path, path, sizeof(loader->path) - 1);
+    loader->path[sizeof(loader->path) - 1] = '\0';
+    AtomicStore(&loader->stage, LOADER_PARSING);
+    if (!StartThread(&loader->worker, load_worker, loader)) {
+        // No thread - do the CPU part right here
+        load_worker(loader);
+    }
+}
+
+void UpdateLevelLoad(LevelLoader *loader) {
+    LoaderStage stage = AtomicLoad(&loader->stage);
+
+    if (stage == LOADER_UPLOADING) {
+        JoinThread(&loader->worker);
+        int count = loader->level.header->imageCount;
+        for (int n = 0; n < LOADER_UPLOADS_PER_FRAME && loader->uploaded < count; n++) {
+            int i = loader->uploaded++;
+            char path[ASSET_PATH_LENGTH];
+            GetLevelImagePath(&loader->level, i, path, sizeof(path));
+            loader->level.textures[i] = AcquireTextureFromImage(path, loader->images[i]);
+            KeepTextureResident(loader->level.textures[i]);  // Tilesets stay resident across restarts
+            UnloadImage(loader->images[i]);
+            loader->images[i] = (Image){0};
+        }
+        if (loader->uploaded == count) {
+            free(loader->images);
+            loader->images = NULL;
+            // Only what the spawn camera will stream in is baked, spread over the next frames
+            LoadMapRenderCache(&loader->cache, &loader->level);
+            loader->bakesTotal = loader->bakesLeft = stream_spawn_area(loader, 0);
+            AtomicStore(&loader->stage, LOADER_BAKING);
+        }
+    } else if (stage == LOADER_BAKING) {
+        loader->bakesLeft = stream_spawn_area(loader, LOADER_BAKES_PER_FRAME);
+        if (loader->bakesLeft == 0) AtomicStore(&loader->stage, LOADER_READY);
+    } else if (stage == LOADER_FAILED) {
+        JoinThread(&loader->worker);
+    }
+}
+
+LoaderStage GetLevelLoadStage(LevelLoader *loader) {
+    return AtomicLoad(&loader->stage);
+}
+
+// Parsing counts for the first 40%, uploads for the next 20%, bakes for the rest
+float GetLevelLoadProgress(LevelLoader *loader) {
+    switch (GetLevelLoadStage(loader)) {
+        case LOADER_UPLOADING: {
+            int count = loader->level.header->imageCount;
+            return 0.4f + 0.2f * (count ? (float)loader->uploaded / count : 1.0f);
+        }
+        case LOADER_BAKING:
+            return 0.6f + 0.4f * (loader->bakesTotal ? 1.0f - (float)loader->bakesLeft / loader->bakesTotal : 1.0f);
+        case LOADER_READY:
+            return 1.0f;
+        default:
+            return 0.0f;
+    }
+}
+
+void TakeLoadedLevel(LevelLoader *loader, Level *level, MapRenderCache *cache) {
+    *level = loader->level;
+    *cache = loader->cache;
+    loader->level = (Level){0};
+    loader->cache = (MapRenderCache){0};
+    AtomicStore(&loader->stage, LOADER_IDLE);
+}
+
+const Level *GetLoadingLevel(LevelLoader *loader) {
+    LoaderStage stage = AtomicLoad(&loader->stage);
+    if (stage == LOADER_IDLE || stage == LOADER_FAILED) return NULL;
+    JoinThread(&loader->worker);  // The worker owns the level until it leaves PARSING
+    return AtomicLoad(&loader->stage) == LOADER_FAILED ? NULL : &loader->level;
+}
+
+void CancelLevelLoad(LevelLoader *loader) {
+    JoinThread(&loader->worker);
+    if (loader->images) {
+        for (int i = 0; i < loader->level.header->imageCount; i++) {
+            if (loader->images[i].data) UnloadImage(loader->images[i]);
+        }
+        free(loader->images);
+        loader->images = NULL;
+    }
+    if (loader->cache.chunksX) UnloadMapRenderCache(&loader->cache);
+    if (loader->level.header) UnloadLevel(&loader->level);
+    loader->uploaded = 0;
+    loader->bakesTotal = loader->bakesLeft = 0;
+    AtomicStore(&loader->stage, LOADER_IDLE);
+}
@@ -0,0 +1,52 @@
+#ifndef LEVEL_LOADER_H
+#define LEVEL_LOADER_H
+
+// Include necessary libraries
+#include "raylib.h"        // Image type
+#include "level.h"         // Level being prepared
+#include "map_renderer.h"  // Chunk cache baked ahead of START
+#include "thread.h"        // Worker thread
+
+// GPU work allowed per frame (keeps the menu at full frame rate)
+#define LOADER_UPLOADS_PER_FRAME 1   // Tileset textures uploaded per frame
+#define LOADER_BAKES_PER_FRAME 4     // Chunks / background segments baked per frame
+
+/*
+    Loader stages
+        PARSING   - worker thread: LoadLevel + decode every tileset image
+        UPLOADING - main thread: a few textures per frame
+        BAKING    - main thread: a few chunk bakes per frame (only what the spawn camera streams in)
+        READY     - level and chunk cache can be handed to the game
+*/
+typedef enum LoaderStage {
+    LOADER_IDLE = 0,
+    LOADER_PARSING,
+    LOADER_UPLOADING,
+    LOADER_BAKING,
+    LOADER_READY,
+    LOADER_FAILED
+} LoaderStage;
+
+// Level prepared in the background while the menu is up
+typedef struct LevelLoader {
+    char path[LEVEL_PATH_LENGTH];
+    Thread worker;
+    AtomicInt stage;          // LoaderStage - the worker only writes it to leave PARSING
+    Level level;
+    Image *images;            // Decoded tileset images, one per level image (worker output)
+    int uploaded;             // Images uploaded so far
+    MapRenderCache cache;
+    int bakesTotal;           // Bakes pending when BAKING started (for progress)
+    int bakesLeft;
+} LevelLoader;
+
+// Function declarations - background level loading
+void StartLevelLoad(LevelLoader *loader, const char *path);   // Start the worker (no-op if a load is already running or ready)
+void UpdateLevelLoad(LevelLoader *loader);                     // Main thread, once per frame: budgeted GPU uploads and bakes
+LoaderStage GetLevelLoadStage(LevelLoader *loader);
+float GetLevelLoadProgress(LevelLoader *loader);               // 0 - 1
+void TakeLoadedLevel(LevelLoader *loader, Level *level, MapRenderCache *cache); // Move a READY level out (loader goes IDLE)
+void CancelLevelLoad(LevelLoader *loader);                     // Wait for the worker and free everything loaded so far
+const Level *GetLoadingLevel(LevelLoader *loader);             // Level being prepared (waits for the worker, NULL if it failed or nothing is loading)
+
+#endif
@@ -1,21 +1,69 @@
 #include "raylib.h"
 #include "game.h"
+#include "ui.h"
+#include "hot_reload.h"
+#include "headless.h"
+#include "jobs.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 int main(int argc, char **argv) {
     // For now its loading the map from commandline args . it shouldbe hardcoded
+    // (map.mrmap from MapCompiler loads fastest, map.tmx still works while authoring)
     if (argc < 2) { 
-        printf("Usage: %s <map.tmx>\n", argv[0]); 
+        printf("Usage: %s <map.mrmap|map.tmx> [--watch] [--record file | --replay file] [--jobs N] [--headless [--ticks N] [--seed N]]\n", argv[0]); 
         return 1; 
     }
+    bool watch = false;     // Hot reload the map and textures on save
+    bool headless = false;  // Simulation only, as fast as possible (no window, GPU or audio)
+    HeadlessOptions headlessOptions = { argv[1], HEADLESS_DEFAULT_TICKS, 1, NULL, NULL };
+    const char *recordPath = NULL;  // Write every tick's controls here (the latest run is kept)
+    const char *replayPath = NULL;  // Play these controls back instead of the keyboard
+    int jobWorkers = -1;            // Job system worker threads (-1 = one per spare core, 0 = none)
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--watch") == 0) watch = true;
+        else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) recordPath = argv[++i];
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) replayPath = argv[++i];
+        else if (strcmp(argv[i], "--headless") == 0) headless = true;
+        else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) headlessOptions.ticks = atol(argv[++i]);
+        else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) jobWorkers = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) headlessOptions.seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+    }
+    headlessOptions.recordPath = recordPath;
+    headlessOptions.replayPath = replayPath;
+    InitJobSystem(jobWorkers);
+    if (headless) {
+        int result = RunHeadless(&headlessOptions);
+        ShutdownJobSystem();
+        return result;
+    }
 
     // Initialize the game window
     InitWindow(DISPLAY_W, DISPLAY_H, "Mana Rush");
     SetTargetFPS(60);
 
     // Load menu 
-    Texture2D menuBackground = LoadTexture("background.png");
+    AssetHandle menuBackground = AcquireTexture("background.png");
+
+    // Load the sprite atlas up front so START doesn't hit the disk
+    if (!PreloadGameAssets()) {
+        printf("Could not load the sprites or animations\n");
+        ReleaseTexture(menuBackground);
+        UnloadAllTextures();
+        ShutdownJobSystem();
+        CloseWindow();
+        return 1;
+    }
+
+    // Start preparing the level in the background while the menu is up
+    LevelLoader loader = {0};
+    StartLevelLoad(&loader, argv[1]);
+    bool startPending = false;  // START clicked before the level was ready
+    HotReload reload = {0};
+    if (watch) InitHotReload(&reload, argv[1]);
+    int shownProgress = -1;     // Percentage currently on the START button
 
     // Load custom font 
     Font menuFont = LoadFont("The Golden Blade.ttf");
@@ -40,32 +88,86 @@ int main(int argc, char **argv) {
     //      Menu 
     //========================
     bool showMenu = true;
+
+    // Text is laid out once here; the whole menu is cached in one panel and only
+    // rebuilt when a button's hover state flips
+    UiText titleText = {0};
+    SetUiText(&titleText, menuFont, 60, 1, "MANA RUSH");
+
     // Buttons
-    Rectangle startButton = {DISPLAY_W/2 - 100, DISPLAY_H/2 - 25, 200, 50};
-    Rectangle exitButton  = {DISPLAY_W/2 - 100, DISPLAY_H/2 + 50, 200, 50};
+    UiButton startButton = { {DISPLAY_W/2 - 100, DISPLAY_H/2 - 25, 200, 50}, {0}, 15, DARKGREEN, GREEN, false };
+    UiButton exitButton  = { {DISPLAY_W/2 - 100, DISPLAY_H/2 + 50, 200, 50}, {0}, 10, MAROON, RED, false };
+    SetUiText(&startButton.label, menuFont, 30, 1, "START");
+    SetUiText(&exitButton.label, menuFont, 30, 1, "EXIT");
+
+    UiPanel menuPanel = {0};
+    menuPanel.dirty = true;
 
     // Game state structure
     GameState game;
+    Replay replay = {0};   // Recording / playback of the current game (with --record / --replay)
 
     // Main Loop
     while (!WindowShouldClose()) {
         // Update music stream (required for streaming music)
         UpdateMusicStream(bgMusic);
 
+        // Apply saved edits (level, tilesets, sprites) before anything uses them this frame
+        if (watch) UpdateHotReload(&reload, showMenu ? NULL : &game, &loader);
+
         // Handle menu state
         if (showMenu) {
+            // A few texture uploads / chunk bakes per frame
+            UpdateLevelLoad(&loader);
+
             Vector2 mousePoint = GetMousePosition();
 
+            // Hover changes are the only thing that invalidates the menu panel
+            if (UpdateUiButton(&startButton, mousePoint)) menuPanel.dirty = true;
+            if (UpdateUiButton(&exitButton, mousePoint)) menuPanel.dirty = true;
+
             // Check if start button is clicked
-            if (CheckCollisionPointRec(mousePoint, startButton) && 
-                IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            if (startButton.hovered && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+                startPending = true;
+            }
+
+            // Switch as soon as the level is ready, show progress on the button until then
+            LoaderStage stage = GetLevelLoadStage(&loader);
+            if (startPending && stage == LOADER_READY) {
                 showMenu = false;
-                InitGame(&game, argv[1]); 
+                startPending = false;
+                InitGameFromLoader(&game, &loader); 
+
+                // Every game starts the recording over, or plays the replay from its first tick
+                if (replayPath) {
+                    if (LoadReplay(&replay, replayPath, SIM_TICK_RATE)) AttachReplay(&game, &replay);
+                    else printf("Could not read replay %s, playing live\n", replayPath);
+                } else if (recordPath && StartReplayRecording(&replay, recordPath, argv[1], game.seed, SIM_TICK_RATE)) {
+                    AttachReplay(&game, &replay);
+                }
+                // Live play keeps the last seconds so they can be rewound (a recording can't be)
+                if (!game.replay) KeepGameHistory(&game, true);
+
+                // Back to the plain label for the next visit to the menu
+                shownProgress = -1;
+                SetUiText(&startButton.label, menuFont, 30, 1, "START");
+                menuPanel.dirty = true;
+            } else if (startPending && stage == LOADER_FAILED) {
+                printf("Could not load %s\n", argv[1]);
+                break;
+            } else if (startPending) {
+                int percent = (int)(GetLevelLoadProgress(&loader) * 100);
+                if (percent != shownProgress) {
+                    char label[32];
+                    sprintf(label, "LOADING %d%%", percent);
+                    SetUiText(&startButton.label, menuFont, 24, 1, label);
+                    shownProgress = percent;
+                    menuPanel.dirty = true;
+                }
             }
 
             // Check if exit button is clicked
-            if (CheckCollisionPointRec(mousePoint, exitButton) &&
-                IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            if (exitButton.hovered && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                 break; // exit game
             }
 
@@ -76,25 +178,29 @@ int main(int argc, char **argv) {
         } 
         // Handle game state (when not in menu)
         else {
-            float dt = GetFrameTime(); // Get delta time for frame-rate independent movement
-            UpdateGame(&game, dt); // Update game logic
+            // Holding BACKSPACE runs time backwards (two ticks a frame), otherwise fixed-rate
+            // ticks for this frame's worth of time
+            if (game.keepHistory && IsKeyDown(KEY_BACKSPACE)) RewindGame(&game, 2);
+            else AdvanceGame(&game, GetFrameTime());
 
             // ESC key returns to menu
             if (IsKeyPressed(KEY_ESCAPE)) {
                 showMenu = true;
                 CleanupGame(&game); // Clean up game resources
+                CloseReplay(&replay); // Finish the recording
+                StartLevelLoad(&loader, argv[1]); // Prepare the next run while the menu is up
             }
         }
 
-        // Begin
-        BeginDrawing();
-        ClearBackground(BLACK);
+        // Rebuild the cached menu before drawing starts
+        if (showMenu && menuPanel.dirty) {
+            BeginUiPanel(&menuPanel, 0, 0, DISPLAY_W, DISPLAY_H);
 
-        if (showMenu) {
-            // Draw menu background 
+            // Menu background 
+            Texture2D *background = GetTexture(menuBackground);
             DrawTexturePro(
-                menuBackground,
-                (Rectangle){ 0, 0, (float)menuBackground.width, (float)menuBackground.height },
+                *background,
+                (Rectangle){ 0, 0, (float)background->width, (float)background->height },
                 (Rectangle){ 0, 0, (float)DISPLAY_W, (float)DISPLAY_H },
                 (Vector2){ 0, 0 },
                 0.0f,
@@ -102,31 +208,21 @@ int main(int argc, char **argv) {
             );
             
             // Title
-            const char *title = "MANA RUSH";
-            Vector2 titlePos = { (DISPLAY_W - MeasureTextEx(menuFont, title, 60, 1).x) / 2, 150 };
-            DrawTextEx(menuFont, title, titlePos, 60, 1, GOLD);
-
-            // START Button
-            Vector2 mousePoint = GetMousePosition();
-            Color btnColorStart = CheckCollisionPointRec(mousePoint, startButton) ? GREEN : DARKGREEN;
-            DrawRectangleRec(startButton, btnColorStart);
-            DrawRectangleLinesEx(startButton, 2, BLACK);
+            DrawUiText(&titleText, (Vector2){ (DISPLAY_W - titleText.size.x) / 2, 150 }, GOLD);
 
-            const char *startText = "START";
-            Vector2 startPos = { startButton.x + (startButton.width - MeasureTextEx(menuFont, startText, 30, 1).x) / 2,
-                                 startButton.y + 15 };
-            DrawTextEx(menuFont, startText, startPos, 30, 1, WHITE);
+            // START / EXIT Buttons
+            DrawUiButton(&startButton);
+            DrawUiButton(&exitButton);
 
-            // EXIT Button
-            Color btnColorExit = CheckCollisionPointRec(mousePoint, exitButton) ? RED : MAROON;
-            DrawRectangleRec(exitButton, btnColorExit);
-            DrawRectangleLinesEx(exitButton, 2, BLACK);
+            EndUiPanel(&menuPanel);
+        }
 
-            const char *exitText = "EXIT";
-            Vector2 exitPos = { exitButton.x + (exitButton.width - MeasureTextEx(menuFont, exitText, 30, 1).x) / 2,
-                                exitButton.y + 10 };
-            DrawTextEx(menuFont, exitText, exitPos, 30, 1, WHITE);
+        // Begin
+        BeginDrawing();
+        ClearBackground(BLACK);
 
+        if (showMenu) {
+            DrawUiPanel(&menuPanel);
         } else {
             // Actual game
             RenderGame(&game);
@@ -139,9 +235,16 @@ int main(int argc, char **argv) {
     if (!showMenu) {
         CleanupGame(&game);
     }
+    CloseReplay(&replay);
 
     //Cleanup
-    UnloadTexture(menuBackground);
+    CancelLevelLoad(&loader);
+    if (watch) FreeHotReload(&reload);
+    UnloadUiPanel(&menuPanel);
+    ReleaseTexture(menuBackground);
+    UnloadGameAssets();
+    UnloadAllTextures();
+    ShutdownJobSystem();
     UnloadFont(menuFont);
     StopMusicStream(bgMusic);
     UnloadMusicStream(bgMusic);
@@ -0,0 +1,78 @@
+#include "level.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+    Offline map compiler
+        -parses a .tmx with libtmx (no textures are loaded)
+        -resolves every gid to its image and source corner
+        -merges the collidable layers into the collision bitmap
+        -writes the result as one .mrmap blob the game maps and uses in place
+    Image paths are stored relative to the .tmx, so keep the .mrmap next to it.
+*/
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        printf("Usage: %s <map.tmx> <map%s>\n", argv[0], LEVEL_EXTENSION);
+        return 1;
+    }
+
+    // Directory part of the input path
+    char directory[LEVEL_PATH_LENGTH] = "";
+    const char *slash = strrchr(argv[1], '/');
+    const char *backslash = strrchr(argv[1], '\\');
+    if (backslash > slash) slash = backslash;
+    if (slash && (size_t)(slash - argv[1] + 1) < sizeof(directory)) {
+        memcpy(directory, argv[1], slash - argv[1] + 1);
+        directory[slash - argv[1] + 1] = '\0';
+    }
+
+    tmx_map *map = LoadTmxForCompile(argv[1]);
+    if (!map) return 1;
+
+    size_t size;
+    void *blob = CompileLevel(map, directory, &size);
+    tmx_map_free(map);
+    if (!blob) {
+        printf("Could not compile %s\n", argv[1]);
+        return 1;
+    }
+
+    // Written next to the target and renamed over it, so a running game (hot reload) that still
+    // has the old file mapped keeps reading the old copy instead of a half-written one
+    char temporary[LEVEL_PATH_LENGTH + 8];
+    snprintf(temporary, sizeof(temporary), "%s.tmp", argv[2]);
+    FILE *out = fopen(temporary, "wb");
+    bool written = out && fwrite(blob, 1, size, out) == size;
+    if (out && fclose(out) != 0) written = false;
+    if (!written) {
+        printf("Could not write %s\n", temporary);
+        free(blob);
+        return 1;
+    }
+#ifdef _WIN32
+    remove(argv[2]);  // rename doesn't replace on Windows
+#endif
+    if (rename(temporary, argv[2]) != 0) {
+        printf("Could not write %s\n", argv[2]);
+        free(blob);
+        return 1;
+    }
+
+    const LevelHeader *header = blob;
+    printf("%s: %dx%d tiles, %d layers, %d images, %d objects, %d chunks of %llu bytes, %zu bytes\n",
+           argv[2], header->width, header->height, header->layerCount,
+           header->imageCount, header->objectCount, header->chunkCount,
+           (unsigned long long)header->chunkStride, size);
+    free(blob);
+
+    // Read it back through the game's loader so a broken file never ships
+    Level level;
+    if (!LoadLevel(&level, argv[2])) {
+        printf("Compiled level failed validation\n");
+        return 1;
+    }
+    UnloadLevel(&level);
+    return 0;
+}
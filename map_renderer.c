@@ -1,31 +1,43 @@
 #include "map_renderer.h"
 #include "projectile.h" 
+#include "particles.h"
+#include "raymath.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <math.h>
 
-//Convert to Texture2D
-void *raylib_tex_loader(const char *path) {
-    Texture2D *returnValue = malloc(sizeof(Texture2D));
-    *returnValue = LoadTexture(path);
-    return returnValue; 
-}
+// Inclusive range of tiles to draw
+typedef struct TileRange {
+    int x0, y0;     // First column / row
+    int x1, y1;     // Last column / row
+} TileRange;
 
-// Textures Deallocator
-void raylib_free_tex(void *ptr) {
-    UnloadTexture(*((Texture2D *) ptr));
-    free(ptr);
-}
+// Work out which tiles the camera can see (plus CULL_MARGIN_TILES on every side)
+static TileRange visible_tile_range(const Level *level, Camera2D camera) {
+    // World-space corners of the screen
+    Vector2 topLeft = GetScreenToWorld2D((Vector2){0, 0}, camera);
+    Vector2 bottomRight = GetScreenToWorld2D((Vector2){GetScreenWidth(), GetScreenHeight()}, camera);
+
+    TileRange range = {
+        (int)(topLeft.x / level->header->tileWidth) - CULL_MARGIN_TILES,
+        (int)(topLeft.y / level->header->tileHeight) - CULL_MARGIN_TILES,
+        (int)(bottomRight.x / level->header->tileWidth) + CULL_MARGIN_TILES,
+        (int)(bottomRight.y / level->header->tileHeight) + CULL_MARGIN_TILES
+    };
 
-// Convert integer  to Raylib Color structure
-Color int_to_color(int color) {
-    tmx_col_bytes res = tmx_col_to_bytes(color);
-    return *((Color*)&res);
+    // Clamp to the map
+    if (range.x0 < 0) range.x0 = 0;
+    if (range.y0 < 0) range.y0 = 0;
+    if (range.x1 > (int)level->header->width - 1) range.x1 = level->header->width - 1;
+    if (range.y1 > (int)level->header->height - 1) range.y1 = level->header->height - 1;
+    return range;
 }
 
-// Draw a single tile from a tileset texture onto the screen
+// Queue a single tile from a tileset texture (drawn when the layer's batches are flushed)
 static void draw_tile(
-    void *image,                // Actual Texture
+    TileBatcher *batcher,       // Per-tileset vertex streams
+    Texture2D *texture,         // Actual Texture
     unsigned int sx,            // src x 
     unsigned int sy,            // src y 
     unsigned int sw,            // width
@@ -36,270 +48,565 @@ static void draw_tile(
     unsigned int flags
 ) {
 
-    Texture2D *texture = (Texture2D*) image; 
     int op = 0xFF * opacity; // Calculate alpha value from opacity ..converts "0-1 to 0-255"
     
-    DrawTextureRec(
-                    *texture, 
-                    (Rectangle){sx, sy, sw, sh}, // Source rectangle 
-                    (Vector2){dx, dy},           // Destination position (where to draw on screen)
-                    (Color){op, op, op, op}      // Opacity
-                );    
+    PushTile(
+                batcher,
+                *texture, 
+                (Rectangle){sx, sy, sw, sh}, // Source rectangle 
+                (Vector2){dx, dy},           // Destination position (where to draw on screen)
+                flags,                       // TMX flip/diagonal bits
+                (Color){op, op, op, op}      // Opacity
+            );    
 }
 
 
-// Draw a single layer from the map
-static void draw_layer(tmx_map *map, tmx_layer *layer) {
-    unsigned long i, j;
-    unsigned int gid, x, y, w, h, flags;
-    float op = layer->opacity; // I dont think we will be using it ,Shomoy paile eite remove korbo 
-    
-    tmx_tileset *ts;    // ptr tileset data
-    tmx_image *im;      // ptr to tile image data
-    void* image;        // ptr to the actual texture/image
+// Draw the tiles of a single layer that fall inside range
+static void draw_layer(const Level *level, int layer, TileRange range, TileBatcher *batcher) {
+    long i, j;
+    unsigned int gid, flags;
+    float op = level->layers[layer].opacity; // I dont think we will be using it ,Shomoy paile eite remove korbo 
+    uint32_t raw;            // gid with the flip bits
+    const LevelTile *tile;   // ptr to the tile's image and source corner
     
 
     /*
-    Iterate through every tile position in the layer (row-major order)
+    Iterate through the visible tile positions in the layer (row-major order)
         i -> row ( y-coordinate)
         j -> col ( x-coordinate)
     */
 
-    for (i = 0; i < map->height; i++) {        
-        for (j = 0; j < map->width; j++) {     
-            // Get the tile ID at this position 
-            gid = (layer->content.gids[(i*map->width)+j]) & TMX_FLIP_BITS_REMOVAL;
+    for (i = range.y0; i <= range.y1; i++) {        
+        for (j = range.x0; j <= range.x1; j++) {     
+            // Get the tile ID at this position (chunked storage, see level.h)
+            raw = GetLevelGid(level, layer, j, i);
+            gid = raw & TMX_FLIP_BITS_REMOVAL;
+            if (gid >= (unsigned int)level->header->tileCount) continue;
             
-            // Check if this tile ID exists
-            if (map->tiles[gid] != NULL) {
-                // Get tileset and image data for that specific tile
-                ts = map->tiles[gid]->tileset;
-                im = map->tiles[gid]->image;
-                x = map->tiles[gid]->ul_x;  // Upper-left X in tileset texture
-                y = map->tiles[gid]->ul_y;  // Upper-left Y in tileset texture
-                w = ts->tile_width;         // Tile width
-                h = ts->tile_height;        // Tile height
-                
-                // Get the actual texture to draw from ? individual tile image : tileset
-                image = im ? im->resource_image : ts->image->resource_image;
-                
+            // Check if this tile ID exists (image and source corner were resolved by the compiler)
+            tile = &level->tiles[gid];
+            if (tile->image >= 0) {
                 // Get the flip flags for this tile (rotation/flipping information)
-                flags = (layer->content.gids[(i*map->width)+j]) & ~TMX_FLIP_BITS_REMOVAL;
-                
+                flags = raw & ~TMX_FLIP_BITS_REMOVAL;
                 
                 draw_tile(
-                        image, x, y, w, h, 
-                        j*ts->tile_width,   // x position (tile coordinate * tile width)
-                        i*ts->tile_height,  // y position (tile coordinate * tile height)
+                        batcher, GetTexture(level->textures[tile->image]),
+                        tile->x, tile->y, tile->width, tile->height, 
+                        j*tile->width,      // x position (tile coordinate * tile width)
+                        i*tile->height,     // y position (tile coordinate * tile height)
                         op, flags           // Opacity and transformation flags
                     );         
             }
         }
     }
+
+    // One submission per tileset used by this layer
+    FlushTileBatches(batcher);
+}
+
+// Which pass a tile layer is drawn in - set with the "background" / "foreground" properties in the map
+static MapLayerRole layer_role(const LevelLayer *layer) {
+    if (layer->flags & LEVEL_LAYER_BACKGROUND) return MAP_LAYER_BACKGROUND;
+    if (layer->flags & LEVEL_LAYER_FOREGROUND) return MAP_LAYER_FOREGROUND;
+    return MAP_LAYER_WORLD;
 }
 
-// Draw all layers and  entities
-static void draw_all_layers(tmx_map *map, tmx_layer *layers, Animation *anim, Boss *boss) {
+// Check whether any visible layer of a role has a tile inside range
+static bool range_has_tiles(const Level *level, TileRange range, MapLayerRole role) {
+    for (int l = 0; l < level->header->layerCount; l++) {
+        if (!(level->layers[l].flags & LEVEL_LAYER_VISIBLE) || layer_role(&level->layers[l]) != role) continue;
+        for (int i = range.y0; i <= range.y1; i++) {
+            for (int j = range.x0; j <= range.x1; j++) {
+                if (GetLevelGid(level, l, j, i) & TMX_FLIP_BITS_REMOVAL) return true;
+            }
+        }
+    }
+    return false;
+}
 
-    Texture2D bossDeathTex = LoadTexture("skill7.png");
-    
-    // Iterate through all layers in the map
-    while (layers) {
+// Bake a tile range into a render texture - only layer `only` if >= 0, otherwise every tile layer of `role`
+static void bake_range(const Level *level, MapRenderCache *cache, RenderTexture2D target, TileRange range,
+                       int only, MapLayerRole role) {
+    // Camera that maps the range's world origin to the texture origin
+    Camera2D bakeCamera = {
+        {0, 0},
+        {(float)(range.x0 * level->header->tileWidth), (float)(range.y0 * level->header->tileHeight)},
+        0.0f,
+        1.0f
+    };
 
-        if (layers->visible && layers->type == L_LAYER) { // check visibility and skip object layers
-            draw_layer(map, layers); 
+    BeginTextureMode(target);
+    ClearBackground(BLANK);
+    BeginMode2D(bakeCamera);
+    // Iterate through all tile layers in the map
+    for (int l = 0; l < level->header->layerCount; l++) {
+        if (level->layers[l].flags & LEVEL_LAYER_VISIBLE) { // check visibility
+            if (only >= 0 ? l == only : layer_role(&level->layers[l]) == role) {
+                draw_layer(level, l, range, &cache->batcher);
+            }
         }
-        layers = layers->next; 
     }
-    
-    /*
-    Draw game entities on top of the tile layers (in correct z-order)
-        -player
-        -boss
-        -projectiles
-    */
-    DrawAnimation(anim);        
-    DrawBoss(boss, bossDeathTex); 
-    DrawProjectiles();          
-    
-    UnloadTexture(bossDeathTex);
+    EndMode2D();
+    EndTextureMode();
 }
 
-// Main map rendering function - draws the entire game scene
-void RenderMap(tmx_map *map, Animation *anim, Boss *boss) {
-    // Set the bg color of the map .Prolly I didn't added any .so its empty basically
-    ClearBackground(int_to_color(map->backgroundcolor));
-    
-    // Draw all layers and game entities
-    draw_all_layers(map, map->ly_head, anim, boss);
+// Bake the static tile layers of the chunk a slot holds into its render textures (world and foreground)
+static void bake_chunk(const Level *level, MapRenderCache *cache, MapChunk *chunk) {
+    int cx = chunk->index % cache->chunksX;
+    int cy = chunk->index / cache->chunksX;
 
+    // Tiles covered by this chunk (edge chunks may be smaller)
+    TileRange range = {
+        cx * MAP_CHUNK_TILES,
+        cy * MAP_CHUNK_TILES,
+        cx * MAP_CHUNK_TILES + MAP_CHUNK_TILES - 1,
+        cy * MAP_CHUNK_TILES + MAP_CHUNK_TILES - 1
+    };
+    if (range.x1 > (int)level->header->width - 1) range.x1 = level->header->width - 1;
+    if (range.y1 > (int)level->header->height - 1) range.y1 = level->header->height - 1;
 
-    //==================================
-        //HEALTH BAR SYSTEM: for player
-    //=================================
-    
-    
-    int barWidth = 40;   // Width px
-    int barHeight = 4;   // Height px
+    bake_range(level, cache, chunk->target, range, -1, MAP_LAYER_WORLD);
 
-    // PLAYER HEALTH BAR: 
-    float playerSpriteW = FRAME_WIDTH * anim->scale;                        //player sprite width
-    float playerBarX = anim->position.x + (playerSpriteW - barWidth) / 2;   // Center above player
-    float playerBarY = anim->position.y - 8;                                // Position above player
-
-
-    // Only draw if player position is valid 
-    if (playerBarX > 0 && playerBarY > 0) {
-        // Draw background of health bar (gray, represents missing health)
-        DrawRectangle((int)playerBarX, (int)playerBarY, barWidth, barHeight, (Color){100, 100, 100, 200});
-        
-        // Calculate current health ratio (0.0 to 1.0)
-        float playerHealthRatio = (float)anim->health / 2000.0f;
-        if (playerHealthRatio < 0) playerHealthRatio = 0; // Clamp at 0
-        
-        // get width of current health portion
-        int playerCurrentHealthWidth = (int)(barWidth * playerHealthRatio);
-        
+    // Most chunks have no grass - only those get a second texture (rebaked once it exists, even if emptied)
+    if (chunk->foreground.id != 0 || range_has_tiles(level, range, MAP_LAYER_FOREGROUND)) {
+        if (chunk->foreground.id == 0) {
+            chunk->foreground = LoadRenderTexture(chunk->target.texture.width, chunk->target.texture.height);
+        }
+        bake_range(level, cache, chunk->foreground, range, -1, MAP_LAYER_FOREGROUND);
+    }
+    chunk->dirty = false;
+}
 
-    /*
-    Draw current health 
-        -Green (>60%), 
-        -Yellow (30-60%), 
-        -Red (<30%)
-    */
+// Tiles covered by one background segment
+static TileRange background_segment_range(const Level *level, const Background *bg, int s) {
+    TileRange range = {
+        s * BACKGROUND_SEGMENT_TILES,
+        bg->firstRow,
+        s * BACKGROUND_SEGMENT_TILES + BACKGROUND_SEGMENT_TILES - 1,
+        bg->firstRow + bg->rowCount - 1
+    };
+    if (range.x1 > (int)level->header->width - 1) range.x1 = level->header->width - 1;
+    return range;
+}
 
-        if (playerCurrentHealthWidth > 0) {
-            Color healthColor;
-            
-            if (playerHealthRatio > 0.6f) healthColor = GREEN;
-            else if (playerHealthRatio > 0.3f) healthColor = YELLOW;
-            else healthColor = RED;
-            
-            DrawRectangle((int)playerBarX, (int)playerBarY, playerCurrentHealthWidth, barHeight, healthColor);
+// Set up a background layer over the rows it uses (the compiler found them, nothing to scan here)
+static void load_background(const Level *level, Background *bg, int layer) {
+    const LevelLayer *source = &level->layers[layer];
+    bg->layer = layer;
+    bg->scroll = (Vector2){ source->parallaxX, source->parallaxY };
+    if (source->lastRow < 0) return; // Empty layer - nothing to draw
+    bg->firstRow = source->firstRow;
+    bg->rowCount = source->lastRow - source->firstRow + 1;
+    bg->segmentCount = (level->header->width + BACKGROUND_SEGMENT_TILES - 1) / BACKGROUND_SEGMENT_TILES;
+}
+
+// Set up the chunk grid and backgrounds - textures are created as the stream window reaches them
+void LoadMapRenderCache(MapRenderCache *cache, const Level *level) {
+    cache->chunksX = (level->header->width + MAP_CHUNK_TILES - 1) / MAP_CHUNK_TILES;
+    cache->chunksY = (level->header->height + MAP_CHUNK_TILES - 1) / MAP_CHUNK_TILES;
+    cache->slots = NULL;
+    cache->slotCount = 0;
+    cache->slotCapacity = 0;
+    cache->batcher = (TileBatcher){0};
+
+    // Backgrounds get their own strips so they can scroll independently
+    cache->backgroundCount = 0;
+    for (int layer = 0; layer < level->header->layerCount; layer++) {
+        if ((level->layers[layer].flags & LEVEL_LAYER_VISIBLE) && layer_role(&level->layers[layer]) == MAP_LAYER_BACKGROUND &&
+            cache->backgroundCount < MAX_BACKGROUNDS) {
+            Background *bg = &cache->backgrounds[cache->backgroundCount++];
+            *bg = (Background){0};
+            load_background(level, bg, layer);
         }
-        
-        // Border 
-        DrawRectangleLines((int)playerBarX, (int)playerBarY, barWidth, barHeight, (Color){0, 0, 0, 100});
     }
+}
 
-    //==================================
-        //HEALTH BAR SYSTEM: for BOSS
-    //=================================
-    /*
-        Only draw if the boss is alive and present on the screen 
-    */
-    
-    if (!boss->isDead && boss->position.x > 0 && boss->position.y > 0) {
-        float bossW = (boss->skillRight.width / 6) * 1.8f; 
-        float bossBarX = boss->position.x + (bossW - barWidth) / 2; 
-        float bossBarY = boss->position.y - 8; 
-
-        // Draw background of the health bar
-        DrawRectangle((int)bossBarX, (int)bossBarY, barWidth, barHeight, (Color){100, 100, 100, 200});
-        
-        // Calculate health ratio
-        float bossHealthRatio = (float)boss->health / 10000.0f;
-        if (bossHealthRatio < 0) bossHealthRatio = 0; // limit at 0
-        
-        // Draw current healt
-        int bossCurrentHealthWidth = (int)(barWidth * bossHealthRatio);
-        if (bossCurrentHealthWidth > 0) {
-            DrawRectangle((int)bossBarX, (int)bossBarY, bossCurrentHealthWidth, barHeight, RED);
+// Make room for one more slot, doubling the array (false if out of memory - the old array is kept)
+static bool grow_slots(void **slots, int *capacity, int count, size_t slotSize) {
+    if (count < *capacity) return true;
+    int newCapacity = *capacity ? *capacity * 2 : 8;
+    void *grown = realloc(*slots, (size_t)newCapacity * slotSize);
+    if (!grown) {
+        TraceLog(LOG_WARNING, "MAP: Out of memory for render cache slots");
+        return false;
+    }
+    *slots = grown;
+    *capacity = newCapacity;
+    return true;
+}
+
+// Slot holding a chunk (NULL if it isn't baked)
+static MapChunk *find_chunk(MapRenderCache *cache, int index) {
+    for (int i = 0; i < cache->slotCount; i++) {
+        if (cache->slots[i].index == index) return &cache->slots[i];
+    }
+    return NULL;
+}
+
+// Flag the chunk holding a tile so it is rebaked before the next draw
+void MarkMapTileDirty(MapRenderCache *cache, int tx, int ty) {
+    int cx = tx / MAP_CHUNK_TILES;
+    int cy = ty / MAP_CHUNK_TILES;
+    if (tx < 0 || ty < 0 || cx >= cache->chunksX || cy >= cache->chunksY) return;
+    MapChunk *chunk = find_chunk(cache, cy * cache->chunksX + cx);
+    if (chunk) chunk->dirty = true;
+}
+
+// Flag the segment of a background layer holding a tile column
+void MarkMapBackgroundDirty(MapRenderCache *cache, int layer, int tx) {
+    for (int b = 0; b < cache->backgroundCount; b++) {
+        Background *bg = &cache->backgrounds[b];
+        if (bg->layer != layer) continue;
+        for (int i = 0; i < bg->slotCount; i++) {
+            if (bg->slots[i].index == tx / BACKGROUND_SEGMENT_TILES) bg->slots[i].dirty = true;
         }
-        
-        // Border
-        DrawRectangleLines((int)bossBarX, (int)bossBarY, barWidth, barHeight, (Color){0, 0, 0, 100});
     }
+}
 
-    //==================================
-        //HUD
-    //=================================
-    
-    int hudX = 10;        // X position from left edge
-    int playerHudY = 10;  // Player HUD Y position
-    int bossHudY = 40;    // Boss HUD Y position (below player HUD)
-    int fontSize = 20;    
-    int padding = 8;      
-    
-    // PLAYER HUD: Always show 
-    char playerHudText[64];
-    sprintf(playerHudText, "Player HP: %d / 2000", anim->health); 
-    Vector2 playerTextSize = MeasureTextEx(GetFontDefault(), playerHudText, fontSize, 1); // Measure text size
-    
-    // Bg for player HUD
-    DrawRectangle(
-                    hudX - padding, 
-                    playerHudY - padding, 
-                    playerTextSize.x + padding * 2, 
-                    playerTextSize.y + padding * 2, 
-                    (Color){0, 0, 0, 230}
-                ); 
-    
-    // Border for player HUD 
-    DrawRectangleLines(
-                        hudX - padding, 
-                        playerHudY - padding, 
-                        playerTextSize.x + padding * 2, 
-                        playerTextSize.y + padding * 2, 
-                        WHITE
-                    ); 
-    
-    // player HUD text
-    // shadow->black
-    // main-text ->green
-    DrawText(playerHudText, hudX + 1, playerHudY + 1, fontSize, BLACK); 
-    DrawText(playerHudText, hudX, playerHudY, fontSize, GREEN); 
-    
-    // BOSS HUD(health): Always show even when dead
+// Flag every baked chunk and segment
+void MarkMapCacheDirty(MapRenderCache *cache) {
+    for (int i = 0; i < cache->slotCount; i++) cache->slots[i].dirty = true;
+    for (int b = 0; b < cache->backgroundCount; b++) {
+        for (int i = 0; i < cache->backgrounds[b].slotCount; i++) cache->backgrounds[b].slots[i].dirty = true;
+    }
+}
 
-    char bossHudText[64];
-    Vector2 bossTextSize;
+// Same size, layer records, gid table and tileset images - only tiles may differ
+static bool same_level_layout(const Level *a, const Level *b) {
+    const LevelHeader *ha = a->header, *hb = b->header;
+    if (ha->width != hb->width || ha->height != hb->height || ha->tileWidth != hb->tileWidth ||
+        ha->tileHeight != hb->tileHeight || ha->layerCount != hb->layerCount ||
+        ha->tileCount != hb->tileCount || ha->imageCount != hb->imageCount) return false;
+    return memcmp(a->layers, b->layers, ha->layerCount * sizeof(LevelLayer)) == 0 &&
+           memcmp(a->tiles, b->tiles, ha->tileCount * sizeof(LevelTile)) == 0 &&
+           memcmp(a->images, b->images, ha->imageCount * sizeof(LevelImage)) == 0;
+}
 
+/*
+    Tile edits only touch a few chunks, so the gids are compared chunk by chunk (one memcmp for
+    the untouched ones) and only the chunks / segments over changed tiles are flagged.
+*/
+bool MarkMapLevelChanges(MapRenderCache *cache, const Level *before, const Level *after) {
+    if (!same_level_layout(before, after)) return false;
 
-   /*
-    !Boss->dead
-        ?current healt
-        : Defeated 
-   */ 
+    int width = after->header->width, height = after->header->height;
+    size_t chunkGids = (size_t)height * LEVEL_CHUNK_TILES;
+    for (int l = 0; l < after->header->layerCount; l++) {
+        bool background = layer_role(&after->layers[l]) == MAP_LAYER_BACKGROUND;
+        for (int c = 0; c < after->header->chunkCount; c++) {
+            const uint32_t *oldGids = GetLevelChunkGids(before, c, l);
+            const uint32_t *newGids = GetLevelChunkGids(after, c, l);
+            if (memcmp(oldGids, newGids, chunkGids * sizeof(uint32_t)) == 0) continue;
 
-    if (!boss->isDead) {
-        sprintf(bossHudText, "Boss HP: %d / 10000", boss->health); 
-        bossTextSize = MeasureTextEx(GetFontDefault(), bossHudText, fontSize, 1);
-    } else {
-        sprintf(bossHudText, "Boss: DEFEATED"); 
-        bossTextSize = MeasureTextEx(GetFontDefault(), bossHudText, fontSize, 1);
+            for (int i = 0; i < height; i++) {
+                for (int j = 0; j < LEVEL_CHUNK_TILES && c * LEVEL_CHUNK_TILES + j < width; j++) {
+                    if (oldGids[i * LEVEL_CHUNK_TILES + j] == newGids[i * LEVEL_CHUNK_TILES + j]) continue;
+                    if (background) MarkMapBackgroundDirty(cache, l, c * LEVEL_CHUNK_TILES + j);
+                    else MarkMapTileDirty(cache, c * LEVEL_CHUNK_TILES + j, i);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Does pixel column span [x, x + width) overlap [left, right]
+static bool span_overlaps(float x, float width, float left, float right) {
+    return x + width >= left && x <= right;
+}
+
+// Slot for a chunk - one already holding it, a free one, one whose chunk left the keep span, or a new one (NULL if out of memory)
+static MapChunk *acquire_chunk(MapRenderCache *cache, const Level *level, int index, StreamWindow window) {
+    MapChunk *chunk = find_chunk(cache, index);
+    if (chunk) return chunk;
+
+    float chunkW = (float)MAP_CHUNK_TILES * level->header->tileWidth;
+    for (int i = 0; i < cache->slotCount && !chunk; i++) {
+        MapChunk *slot = &cache->slots[i];
+        if (slot->index < 0 || !span_overlaps((slot->index % cache->chunksX) * chunkW, chunkW, window.keep0, window.keep1)) {
+            chunk = slot;
+        }
+    }
+    if (!chunk) {
+        if (!grow_slots((void **)&cache->slots, &cache->slotCapacity, cache->slotCount, sizeof(MapChunk))) return NULL;
+        chunk = &cache->slots[cache->slotCount++];
+        *chunk = (MapChunk){0};
+        chunk->target = LoadRenderTexture(MAP_CHUNK_TILES * level->header->tileWidth, MAP_CHUNK_TILES * level->header->tileHeight);
+    }
+    chunk->index = index;
+    chunk->dirty = true;
+    return chunk;
+}
+
+// Layer-space horizontal offset of a background: (camera - map center) * (1 - scroll)
+static Vector2 background_offset(const Level *level, const Background *bg, Camera2D camera) {
+    return (Vector2){
+        (camera.target.x - GetLevelPixelWidth(level) / 2) * (1.0f - bg->scroll.x),
+        (camera.target.y - GetLevelPixelHeight(level) / 2) * (1.0f - bg->scroll.y)
+    };
+}
+
+// Segments of one wrap of a background overlapping the layer-space span [left, right] (false if none)
+static bool wrap_segments(const Level *level, const Background *bg, int wrap, float left, float right, int *s0, int *s1) {
+    float base = wrap * GetLevelPixelWidth(level);
+    float segmentW = (float)BACKGROUND_SEGMENT_TILES * level->header->tileWidth;
+    *s0 = (int)floorf((left - base) / segmentW);
+    *s1 = (int)floorf((right - base) / segmentW);
+    if (*s0 < 0) *s0 = 0;
+    if (*s1 > bg->segmentCount - 1) *s1 = bg->segmentCount - 1;
+    return *s0 <= *s1;
+}
+
+// Is a segment inside the layer-space span [left, right] in any wrap
+static bool segment_in_span(const Level *level, const Background *bg, int s, float left, float right) {
+    float mapW = GetLevelPixelWidth(level);
+    for (int wrap = (int)floorf(left / mapW); wrap <= (int)floorf(right / mapW); wrap++) {
+        int s0, s1;
+        if (wrap_segments(level, bg, wrap, left, right, &s0, &s1) && s >= s0 && s <= s1) return true;
+    }
+    return false;
+}
+
+// Slot for a background segment (same reuse rules as the chunks, in the layer's own space)
+static BackgroundSegment *acquire_segment(const Level *level, Background *bg, int s, float keep0, float keep1) {
+    BackgroundSegment *segment = NULL;
+    for (int i = 0; i < bg->slotCount; i++) {
+        if (bg->slots[i].index == s) return &bg->slots[i];
+    }
+    for (int i = 0; i < bg->slotCount && !segment; i++) {
+        BackgroundSegment *slot = &bg->slots[i];
+        if (slot->index < 0 || !segment_in_span(level, bg, slot->index, keep0, keep1)) segment = slot;
+    }
+    if (!segment) {
+        if (!grow_slots((void **)&bg->slots, &bg->slotCapacity, bg->slotCount, sizeof(BackgroundSegment))) return NULL;
+        segment = &bg->slots[bg->slotCount++];
+        segment->target = LoadRenderTexture(BACKGROUND_SEGMENT_TILES * level->header->tileWidth, bg->rowCount * level->header->tileHeight);
+    }
+    segment->index = s;
+    segment->dirty = true;
+    return segment;
+}
+
+/*
+    Two passes per kind: what's on screen first (baked right away when bakeVisible is set, so
+    nothing ever pops in), then the rest of the load span against the budget. Slots that fall
+    out of the keep span are only reused, never freed, so moving back and forth costs nothing.
+*/
+int StreamMapRenderCache(MapRenderCache *cache, const Level *level, Camera2D camera, StreamWindow window, int budget, bool bakeVisible) {
+    int pending = 0;
+    float mapW = GetLevelPixelWidth(level);
+
+    for (int b = 0; b < cache->backgroundCount; b++) {
+        Background *bg = &cache->backgrounds[b];
+        if (bg->rowCount == 0) continue;
+        float shift = background_offset(level, bg, camera).x;
+        for (int pass = 0; pass < 2; pass++) {
+            float left = (pass ? window.load0 : window.view0) - shift;
+            float right = (pass ? window.load1 : window.view1) - shift;
+            for (int wrap = (int)floorf(left / mapW); wrap <= (int)floorf(right / mapW); wrap++) {
+                int s0, s1;
+                if (!wrap_segments(level, bg, wrap, left, right, &s0, &s1)) continue;
+                for (int s = s0; s <= s1; s++) {
+                    if (pass == 1 && segment_in_span(level, bg, s, window.view0 - shift, window.view1 - shift)) continue;
+                    BackgroundSegment *segment = acquire_segment(level, bg, s, window.keep0 - shift, window.keep1 - shift);
+                    if (!segment || !segment->dirty) continue;  // No slot (out of memory) - left undrawn
+                    if (budget > 0 || (pass == 0 && bakeVisible)) {
+                        bake_range(level, cache, segment->target, background_segment_range(level, bg, s), bg->layer, MAP_LAYER_BACKGROUND);
+                        segment->dirty = false;
+                        budget--;
+                    } else {
+                        pending++;
+                    }
+                }
+            }
+        }
+    }
+
+    float chunkW = (float)MAP_CHUNK_TILES * level->header->tileWidth;
+    for (int pass = 0; pass < 2; pass++) {
+        float left = pass ? window.load0 : window.view0;
+        float right = pass ? window.load1 : window.view1;
+        int cx0 = (int)floorf(left / chunkW), cx1 = (int)floorf(right / chunkW);
+        if (cx0 < 0) cx0 = 0;
+        if (cx1 > cache->chunksX - 1) cx1 = cache->chunksX - 1;
+        for (int cx = cx0; cx <= cx1; cx++) {
+            if (pass == 1 && span_overlaps(cx * chunkW, chunkW, window.view0, window.view1)) continue;
+            for (int cy = 0; cy < cache->chunksY; cy++) {
+                MapChunk *chunk = acquire_chunk(cache, level, cy * cache->chunksX + cx, window);
+                if (!chunk || !chunk->dirty) continue;
+                if (budget > 0 || (pass == 0 && bakeVisible)) {
+                    bake_chunk(level, cache, chunk);
+                    budget--;
+                } else {
+                    pending++;
+                }
+            }
+        }
+    }
+    return pending;
+}
+
+// Release every chunk and segment render texture
+void UnloadMapRenderCache(MapRenderCache *cache) {
+    for (int i = 0; i < cache->slotCount; i++) {
+        UnloadRenderTexture(cache->slots[i].target);
+        if (cache->slots[i].foreground.id != 0) UnloadRenderTexture(cache->slots[i].foreground);
+    }
+    free(cache->slots);
+    cache->slots = NULL;
+    cache->slotCount = 0;
+    cache->slotCapacity = 0;
+    for (int b = 0; b < cache->backgroundCount; b++) {
+        for (int i = 0; i < cache->backgrounds[b].slotCount; i++) {
+            UnloadRenderTexture(cache->backgrounds[b].slots[i].target);
+        }
+        free(cache->backgrounds[b].slots);
+    }
+    cache->backgroundCount = 0;
+    FreeTileBatcher(&cache->batcher);
+    cache->chunksX = cache->chunksY = 0;
+}
+
+// Queue a baked render texture at a world position
+static void submit_baked(RenderQueue *queue, RenderLayer layer, int depth, Texture2D tex, Vector2 position) {
+    SubmitSprite(
+                    queue, layer, depth, tex,
+                    (Rectangle){0, 0, tex.width, -tex.height},  // Render textures are stored upside down
+                    (Rectangle){position.x, position.y, tex.width, tex.height},
+                    (Vector2){0, 0}, 0.0f, WHITE
+                );
+}
+
+/*
+    Queue the parallax backgrounds.
+    Each layer is offset by (camera - map center) * (1 - scroll), so a scroll of 1 sits still in the
+    world and smaller values follow the camera more. Layers wrap horizontally so the slower
+    layers never leave gaps at the ends of the level. Only the segments on screen are drawn.
+*/
+static void draw_backgrounds(const Level *level, MapRenderCache *cache, Camera2D camera, RenderQueue *queue) {
+    Vector2 topLeft = GetScreenToWorld2D((Vector2){0, 0}, camera);
+    Vector2 bottomRight = GetScreenToWorld2D((Vector2){GetScreenWidth(), GetScreenHeight()}, camera);
+    float mapW = GetLevelPixelWidth(level);
+    float segmentW = BACKGROUND_SEGMENT_TILES * level->header->tileWidth;
+
+    for (int b = 0; b < cache->backgroundCount; b++) {
+        Background *bg = &cache->backgrounds[b];
+        if (bg->rowCount == 0) continue;
+        Vector2 offset = background_offset(level, bg, camera);
+        float y = bg->firstRow * level->header->tileHeight + offset.y;
+
+        // Visible span in the layer's own (wrapped) space
+        float left = topLeft.x - offset.x;
+        float right = bottomRight.x - offset.x;
+        for (int wrap = (int)floorf(left / mapW); wrap <= (int)floorf(right / mapW); wrap++) {
+            int s0, s1;
+            if (!wrap_segments(level, bg, wrap, left, right, &s0, &s1)) continue;
+            for (int i = 0; i < bg->slotCount; i++) {
+                BackgroundSegment *segment = &bg->slots[i];
+                if (segment->index < s0 || segment->index > s1 || segment->dirty) continue; // Off screen / not baked yet
+                float x = wrap * mapW + segment->index * segmentW;
+                submit_baked(queue, RENDER_LAYER_BACKGROUND, b, segment->target.texture, (Vector2){x + offset.x, y}); // Map order back to front
+            }
+        }
+    }
+}
+
+// Queue the baked chunks overlapping range and the entities (layer order comes from the sort keys)
+static void draw_all_layers(const Level *level, MapRenderCache *cache, TileRange range, const World *world, float alpha, RenderQueue *queue) {
+
+    // One quad per visible chunk instead of one draw per tile
+    for (int cy = range.y0 / MAP_CHUNK_TILES; cy <= range.y1 / MAP_CHUNK_TILES; cy++) {
+        for (int cx = range.x0 / MAP_CHUNK_TILES; cx <= range.x1 / MAP_CHUNK_TILES; cx++) {
+            MapChunk *chunk = find_chunk(cache, cy * cache->chunksX + cx);
+            if (!chunk || chunk->dirty) continue; // Not streamed in yet
+            Vector2 position = {cx * MAP_CHUNK_TILES * level->header->tileWidth, cy * MAP_CHUNK_TILES * level->header->tileHeight};
+            submit_baked(queue, RENDER_LAYER_WORLD, 0, chunk->target.texture, position);
+            if (chunk->foreground.id != 0) {
+                submit_baked(queue, RENDER_LAYER_FOREGROUND, 0, chunk->foreground.texture, position);
+            }
+        }
     }
-    
-    // Bg for boss
-    DrawRectangle(
-                    hudX - padding, 
-                    bossHudY - padding, 
-                    bossTextSize.x + padding * 2,
-                    bossTextSize.y + padding * 2, 
-                    (Color){0, 0, 0, 230}
-                ) ;
-    
-    // Border for boss
-    DrawRectangleLines(
-                        hudX - padding, 
-                        bossHudY - padding, 
-                        bossTextSize.x + padding * 2,
-                        bossTextSize.y + padding * 2, 
-                        WHITE
-                    );
     
     /*
-        Boss HUD {
-            Alive -> Red
-            Dead->Gray
-        }
-        first lines are strokes or shadow whatever 
+    Game entities go between the world and foreground tiles
+        -entity sprites (player, boss)
+        -projectiles
+        -particles (trails, impact sparks, boss death)
+    All only submit what is near the screen (there can be thousands)
     */
-    if (!boss->isDead) {
-        DrawText(bossHudText, hudX + 1, bossHudY + 1, fontSize, BLACK); 
-        DrawText(bossHudText, hudX, bossHudY, fontSize, RED); 
-    } else {
-        DrawText(bossHudText, hudX + 1, bossHudY + 1, fontSize, BLACK); 
-        DrawText(bossHudText, hudX, bossHudY, fontSize, GRAY); 
+    Rectangle view = {
+        range.x0 * level->header->tileWidth,
+        range.y0 * level->header->tileHeight,
+        (range.x1 - range.x0 + 1) * level->header->tileWidth,
+        (range.y1 - range.y0 + 1) * level->header->tileHeight
+    };
+    DrawSprites(world, alpha, view, queue);
+    DrawProjectiles(alpha, view, queue);
+    DrawParticles(view, queue);
+}
+
+/*
+    Health bar above every entity that can be hit (enabled collider)
+    Fill colour is the entity's bar colour, or by what's left:
+        -Green (>60%)
+        -Yellow (30-60%)
+        -Red (<30%)
+*/
+static void draw_health_bars(const World *world, float alpha) {
+    int barWidth = 40;   // Width px
+    int barHeight = 4;   // Height px
+
+    const ComponentSet *healths = &world->components[COMPONENT_HEALTH];
+    for (int i = 0; i < healths->count; i++) {
+        const Health *health = ComponentAt(healths, i);
+        const Transform *transform = GetComponentOfSlot(world, healths->slots[i], COMPONENT_TRANSFORM);
+        const Collider *collider = GetComponentOfSlot(world, healths->slots[i], COMPONENT_COLLIDER);
+        if (!transform || !collider || !collider->enabled) continue;
+
+        Vector2 position = Vector2Lerp(transform->previousPosition, transform->position, alpha); // Same spot the sprite is drawn at
+        float barX = position.x + (collider->size.x - barWidth) / 2;  // Centred above the entity
+        float barY = position.y - 8;
+
+        // Only draw if the position is valid
+        if (barX <= 0 || barY <= 0) continue;
+
+        // Background (gray, represents missing health)
+        DrawRectangle((int)barX, (int)barY, barWidth, barHeight, (Color){100, 100, 100, 200});
+
+        // Current health ratio (0.0 to 1.0)
+        float ratio = health->max > 0 ? (float)health->current / health->max : 0.0f;
+        if (ratio < 0) ratio = 0; // Clamp at 0
+
+        int currentWidth = (int)(barWidth * ratio);
+        if (currentWidth > 0) {
+            Color color = health->barColor;
+            if (color.a == 0) {
+                if (ratio > 0.6f) color = GREEN;
+                else if (ratio > 0.3f) color = YELLOW;
+                else color = RED;
+            }
+            DrawRectangle((int)barX, (int)barY, currentWidth, barHeight, color);
+        }
+
+        // Border
+        DrawRectangleLines((int)barX, (int)barY, barWidth, barHeight, (Color){0, 0, 0, 100});
     }
-}
\ No newline at end of file
+}
+
+// Main map rendering function - draws the entire game scene
+void RenderMap(const Level *level, MapRenderCache *cache, RenderQueue *queue, Camera2D camera, const World *world, float alpha) {
+    // Set the bg color of the map .Prolly I didn't added any .so its empty basically
+    const uint8_t *bg = level->header->backgroundColor;
+    ClearBackground((Color){bg[0], bg[1], bg[2], bg[3]});
+    
+    // Parallax backgrounds behind everything else
+    draw_backgrounds(level, cache, camera, queue);
+
+    // Queue all layers and game entities (chunks culled to the camera view), then draw them sorted
+    TileRange range = visible_tile_range(level, camera);
+    draw_all_layers(level, cache, range, world, alpha, queue);
+    FlushRenderQueue(queue);
+
+    // Health bars on top of everything in the world
+    draw_health_bars(world, alpha);
+}
@@ -2,45 +2,147 @@
 #define MAP_RENDERER_H
 
 #include "raylib.h"      
-#include "tmx.h"         
-#include "character.h"   
-#include "boss.h"        
+#include "level.h"       
+#include "ecs.h"         
+#include "tile_batch.h"  
+#include "render_queue.h"
+#include "world_stream.h"
 
+// Extra tiles drawn around the camera view so sprites wider than a tile never pop at the edges
+#define CULL_MARGIN_TILES 2
+
+// Static tile layers are pre-rendered in square chunks of this many tiles
+#define MAP_CHUNK_TILES 32
+
+// Backgrounds are baked into horizontal segments of this many tiles (keeps textures under GPU size limits)
+#define BACKGROUND_SEGMENT_TILES 64
+#define MAX_BACKGROUNDS 8        // Maximum number of parallax background layers
+
+/*
+    Only chunks and segments inside the stream window (world_stream.h) are baked. Their textures
+    live in slots that are handed from chunk to chunk as the camera moves, so the number of
+    render textures follows the screen size, not the level length.
+*/
+
+// Baked strip of a background
+typedef struct BackgroundSegment {
+    int index;                   // Segment held by this slot (-1 = free)
+    RenderTexture2D target;      // Full segment size (the last segment leaves the rest blank)
+    bool dirty;                  // Needs a bake before it can be drawn
+} BackgroundSegment;
+
+// Parallax background - a tile layer declared with the "background" property in the map
+typedef struct Background {
+    int layer;                   // Source tile layer index
+    Vector2 scroll;              // Scroll factor from the layer's parallax (1 = moves with the world)
+    int firstRow;                // First row holding tiles
+    int rowCount;                // Rows holding tiles (0 = nothing to draw)
+    int segmentCount;            // Segments across the level
+    BackgroundSegment *slots;    // Baked segments near the camera
+    int slotCount, slotCapacity;
+} Background;
+
+// Draw pass of a tile layer, picked by the "background" / "foreground" bool properties in the map
+typedef enum MapLayerRole {
+    MAP_LAYER_WORLD = 0,     // Baked into the chunks, drawn behind entities
+    MAP_LAYER_BACKGROUND,    // Parallax background strips
+    MAP_LAYER_FOREGROUND     // Baked into separate chunk textures drawn over entities
+} MapLayerRole;
+
+// One pre-rendered block of the static tile layers
+typedef struct MapChunk {
+    int index;                   // Chunk held by this slot (cy * chunksX + cx, -1 = free)
+    RenderTexture2D target;      // Baked tiles of the world layers (full chunk size)
+    RenderTexture2D foreground;  // Baked tiles of the foreground layers (id 0 until a chunk with some used the slot)
+    bool dirty;                  // Needs a bake before it can be drawn
+} MapChunk;
+
+// Baked chunk cache for a map
+typedef struct MapRenderCache {
+    int chunksX, chunksY;    // Chunk grid size
+    MapChunk *slots;         // Baked chunks near the camera
+    int slotCount, slotCapacity;
+    Background backgrounds[MAX_BACKGROUNDS]; // Parallax layers (drawn first, not part of the chunks)
+    int backgroundCount;
+    TileBatcher batcher;     // Per-tileset vertex streams reused by every bake
+} MapRenderCache;
 
 /**
- * @brief Texture loader for libtmx
- * @param path  to the texture 
- * @return Pointer to the loaded Raylib Texture2D
+ * @brief Set up the chunk grid and backgrounds (no textures yet - streaming creates them)
+ * @param cache Cache to fill
+ * @param level Loaded level data
  */
-void *raylib_tex_loader(const char *path);
+void LoadMapRenderCache(MapRenderCache *cache, const Level *level);
 
 /**
- * @brief Texture deallocator for libtmx
- * @param ptr Pointer to the Texture2D 
+ * @brief Flag the chunk containing a tile for rebaking (if it is baked at all)
+ * @param cache Chunk cache
+ * @param tx Tile column
+ * @param ty Tile row
  */
-void raylib_free_tex(void *ptr);
+void MarkMapTileDirty(MapRenderCache *cache, int tx, int ty);
 
 /**
- * @brief Convert libtmx int to raylib Color 
- * @param color Integer color value 
- * @return Color Raylib Color structure equivalent
+ * @brief Flag the background segment of a layer containing a tile column for rebaking
+ * @param cache Chunk cache
+ * @param layer Tile layer of the background
+ * @param tx Tile column
  */
-Color int_to_color(int color);
+void MarkMapBackgroundDirty(MapRenderCache *cache, int layer, int tx);
 
+/**
+ * @brief Flag everything baked so far for rebaking (e.g. a tileset image changed)
+ * @param cache Chunk cache
+ */
+void MarkMapCacheDirty(MapRenderCache *cache);
+
+/**
+ * @brief Compare a reloaded level with the one the cache was baked from and flag only what changed
+ * @param cache Chunk cache baked from before
+ * @param before Level the cache was baked from
+ * @param after Reloaded level
+ * @return false if the two differ in size, layers or tilesets (the cache has to be reloaded instead)
+ */
+bool MarkMapLevelChanges(MapRenderCache *cache, const Level *before, const Level *after);
+
+/**
+ * @brief Bring the baked chunks and segments in line with a stream window.
+ *        Must be called outside BeginMode2D (baking switches render targets)
+ * @param cache Chunk cache
+ * @param level Loaded level data
+ * @param camera Camera the window was made for (places the parallax layers)
+ * @param window Spans to load / keep
+ * @param budget Bakes allowed for the off-screen part of the load span (0 just counts)
+ * @param bakeVisible Bake everything on screen now, whatever the budget
+ * @return Bakes still pending in the load span
+ */
+int StreamMapRenderCache(MapRenderCache *cache, const Level *level, Camera2D camera, StreamWindow window, int budget, bool bakeVisible);
+
+/**
+ * @brief Release all chunk render textures
+ * @param cache Chunk cache
+ */
+void UnloadMapRenderCache(MapRenderCache *cache);
 
 /**
  * @brief Main function to render the entire game map with all layers and entities
- * @param map Pointer to the loaded TMX map data
- * @param anim Pointer to the player character animation data
- * @param boss Pointer to the boss enemy data
+ * @param level Loaded level data
+ * @param cache Baked chunks and backgrounds of the static tile layers
+ * @param queue Render queue the layers and entities are submitted to (flushed before returning)
+ * @param camera Camera the map is drawn with (only tiles inside its view are drawn)
+ * @param world Entities - sprites are drawn, and health bars for those with a collider
+ * @param alpha Where between the last two simulation ticks to draw the entities (0 - 1)
  * 
  * This function:
- * - Renders all visible tile layers in correct order
+ * - Draws the parallax backgrounds, each offset by its own scroll factor
+ * - Draws the baked chunks of the tile layers that the camera can see (chunks still waiting for a bake are skipped)
  * - Renders object layers (if any)
- * - Draws the player character and boss 
+ * - Draws the entity sprites (player, boss) and projectiles
+ * - Draws the foreground chunks (grass) over the entities
+ * - Draws the health bars of entities that can be hit on top
  * 
- * background -> tiles -> entities -> foreground)
+ * background -> tiles -> entities -> foreground (sort order of the render queue)
  */
-void RenderMap(tmx_map *map, Animation *anim, Boss *boss);
+void RenderMap(const Level *level, MapRenderCache *cache, RenderQueue *queue, Camera2D camera, const World *world, float alpha);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,112 @@
+#ifndef _WIN32
+#define _DEFAULT_SOURCE  // madvise
+#endif
+#include "mapped_file.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#ifndef _WIN32_WINNT
+#define _WIN32_WINNT 0x0602  // PrefetchVirtualMemory (Windows 8)
+#endif
+#include <windows.h>
+
+bool MapFile(MappedFile *file, const char *path) {
+    *file = (MappedFile){0};
+    HANDLE fh = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fh == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fh, &size) || size.QuadPart == 0) {
+        CloseHandle(fh);
+        return false;
+    }
+
+    // The mapping object keeps the file open, so the file handle can go right away
+    HANDLE mapping = CreateFileMappingA(fh, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(fh);
+    if (!mapping) return false;
+
+    file->data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!file->data) {
+        CloseHandle(mapping);
+        return false;
+    }
+    file->size = (size_t)size.QuadPart;
+    file->handle = mapping;
+    return true;
+}
+
+void UnmapFile(MappedFile *file) {
+    if (file->data) UnmapViewOfFile(file->data);
+    if (file->handle) CloseHandle(file->handle);
+    *file = (MappedFile){0};
+}
+
+void AdviseMappedRange(const MappedFile *file, size_t offset, size_t length, bool needed) {
+    if (!file->data || offset >= file->size) return;
+    if (length > file->size - offset) length = file->size - offset;
+    void *start = (char *)file->data + offset;
+    if (needed) {
+        WIN32_MEMORY_RANGE_ENTRY range = { start, length };
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    } else {
+        // Unlocking pages that were never locked takes them out of the working set
+        VirtualUnlock(start, length);
+    }
+}
+
+#else
+#include "raylib.h"  // TraceLog (no windows.h on this side)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+bool MapFile(MappedFile *file, const char *path) {
+    *file = (MappedFile){0};
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+
+    file->data = data;
+    file->size = (size_t)st.st_size;
+    return true;
+}
+
+void UnmapFile(MappedFile *file) {
+    if (file->data) munmap((void *)file->data, file->size);
+    *file = (MappedFile){0};
+}
+
+/*
+    madvise wants page-aligned ranges, and pages aren't always LEVEL_CHUNK_ALIGN (16 KiB on Apple
+    Silicon), so the range is rounded to the real page size: outward when reading ahead, inward
+    when dropping so pages shared with a neighbouring range stay
+*/
+void AdviseMappedRange(const MappedFile *file, size_t offset, size_t length, bool needed) {
+    if (!file->data || offset >= file->size) return;
+    if (length > file->size - offset) length = file->size - offset;
+
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t first = needed ? offset / page * page : (offset + page - 1) / page * page;
+    size_t end = needed ? (offset + length + page - 1) / page * page : (offset + length) / page * page;
+    if (end <= first) return;  // Dropping less than a page
+
+    // Dropped pages of a read-only file mapping are read back from the file on the next touch
+    if (madvise((char *)file->data + first, end - first, needed ? MADV_WILLNEED : MADV_DONTNEED) != 0) {
+        TraceLog(LOG_WARNING, "MAPPED FILE: madvise of %zu bytes at %zu failed (%s)", end - first, first, strerror(errno));
+    }
+}
+#endif
@@ -0,0 +1,20 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+// Kept free of raylib.h so the platform headers (windows.h) don't clash with raylib names
+#include <stddef.h>
+#include <stdbool.h>
+
+// Read-only memory mapping of a whole file
+typedef struct MappedFile {
+    const void *data;   // First byte of the file (NULL when not mapped)
+    size_t size;        // File size in bytes
+    void *handle;       // Platform mapping handle (Windows only)
+} MappedFile;
+
+// Function declarations - file mapping
+bool MapFile(MappedFile *file, const char *path);  // Map a file read-only. Returns false if it can't be opened
+void UnmapFile(MappedFile *file);                  // Release the mapping
+void AdviseMappedRange(const MappedFile *file, size_t offset, size_t length, bool needed); // Read a range ahead / drop its pages
+
+#endif
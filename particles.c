@@ -0,0 +1,197 @@
+#include "particles.h"
+#include <math.h>
+#include <string.h>
+
+// Global variables for particle system
+ParticlePool particles;                                // Every live particle, one array per field
+static ParticleEmitter emitters[MAX_PARTICLE_EMITTERS];
+static AssetHandle particleTexture;                    // Soft white dot, tinted per particle
+
+// Look of each effect
+static const ParticleStyle styles[PARTICLE_EFFECT_COUNT] = {
+    [PARTICLE_TRAIL] = {
+        .speedMin = 10, .speedMax = 40, .spread = 0.6f,
+        .lifeMin = 0.2f, .lifeMax = 0.45f,
+        .sizeStart = 7, .sizeEnd = 1,
+        .gravity = -30, .drag = 2.0f, .jitter = 3,
+        .colorStart = {255, 230, 90, 200}, .colorEnd = {255, 80, 0, 0}
+    },
+    [PARTICLE_IMPACT] = {
+        .speedMin = 80, .speedMax = 260, .spread = 1.2f,
+        .lifeMin = 0.2f, .lifeMax = 0.5f,
+        .sizeStart = 5, .sizeEnd = 1,
+        .gravity = 400, .drag = 3.0f, .jitter = 4,
+        .colorStart = {255, 240, 160, 255}, .colorEnd = {255, 60, 0, 0}
+    },
+    [PARTICLE_BOSS_DEATH] = {
+        .speedMin = 20, .speedMax = 90, .spread = PI,
+        .lifeMin = 0.6f, .lifeMax = 1.4f,
+        .sizeStart = 10, .sizeEnd = 28,
+        .gravity = -60, .drag = 1.0f, .jitter = 60,
+        .colorStart = {255, 140, 40, 220}, .colorEnd = {60, 60, 60, 0}
+    },
+};
+
+// Soft round dot: white, alpha falling off from the centre
+static Image GenerateParticleImage(void) {
+    Image image = GenImageColor(16, 16, BLANK);
+    for (int y = 0; y < 16; y++) {
+        for (int x = 0; x < 16; x++) {
+            float dist = sqrtf((x - 7.5f) * (x - 7.5f) + (y - 7.5f) * (y - 7.5f)) / 8.0f;
+            if (dist < 1.0f) ImageDrawPixel(&image, x, y, (Color){255, 255, 255, (unsigned char)(255 * (1.0f - dist))});
+        }
+    }
+    return image;  // The asset cache uploads it (and frees the image)
+}
+
+void InitParticles(void) {
+    particles.count = 0;
+    SeedRng(&particles.rng, 0x2545F491u);  // Fixed - particles never feed back into the game
+    memset(emitters, 0, sizeof(emitters));
+
+    // Generated once and kept resident so restarts don't rebuild it
+    particleTexture = AcquireGeneratedTexture("generated:particle", GenerateParticleImage);
+    KeepTextureResident(particleTexture);
+}
+
+void CleanupParticles(void) {
+    particles.count = 0;
+    memset(emitters, 0, sizeof(emitters));
+    ReleaseTexture(particleTexture);
+}
+
+// min .. max from the particle RNG
+static float random_range(float min, float max) {
+    return min + (max - min) * (float)(NextRng(&particles.rng) >> 8) * (1.0f / 16777216.0f);
+}
+
+int EmitParticles(ParticleEffect effect, Vector2 position, float angle, int count) {
+    ParticlePool *pool = &particles;
+    const ParticleStyle *style = &styles[effect];
+    if (count > PARTICLE_CAPACITY - pool->count) count = PARTICLE_CAPACITY - pool->count;  // Full - the rest are dropped
+
+    for (int n = 0; n < count; n++) {
+        int i = pool->count++;
+        float direction = angle + random_range(-style->spread, style->spread);
+        float speed = random_range(style->speedMin, style->speedMax);
+        pool->x[i] = position.x + random_range(-style->jitter, style->jitter);
+        pool->y[i] = position.y + random_range(-style->jitter, style->jitter);
+        pool->velocityX[i] = cosf(direction) * speed;
+        pool->velocityY[i] = sinf(direction) * speed;
+        pool->gravity[i] = style->gravity;
+        pool->drag[i] = style->drag;
+        pool->age[i] = 0.0f;
+        pool->ageRate[i] = 1.0f / random_range(style->lifeMin, style->lifeMax);
+        pool->effect[i] = (unsigned char)effect;
+    }
+    return count > 0 ? count : 0;
+}
+
+int StartParticleEmitter(ParticleEffect effect, Vector2 position, float angle, float rate, float duration) {
+    for (int e = 0; e < MAX_PARTICLE_EMITTERS; e++) {
+        if (emitters[e].active) continue;
+        emitters[e] = (ParticleEmitter){ true, effect, position, angle, rate, 0.0f, duration };
+        return e;
+    }
+    return -1;
+}
+
+/*
+    Move and age every particle, 4 lanes at a time:
+        velocity loses drag * dt of itself, then gains gravity * dt
+        position follows velocity
+        a lane whose age reaches 1 is marked dead
+    Lanes past count are updated too - harmless, the arrays are sized in whole blocks
+*/
+static void move_particles(ParticlePool *pool, float delta) {
+    F4 dt = F4Set(delta);
+    F4 one = F4Set(1.0f);
+    for (int i = 0; i < pool->count; i += SIMD_WIDTH) {
+        F4 keep = F4Sub(one, F4Mul(F4Load(&pool->drag[i]), dt));
+        F4 velocityX = F4Mul(F4Load(&pool->velocityX[i]), keep);
+        F4 velocityY = F4Add(F4Mul(F4Load(&pool->velocityY[i]), keep), F4Mul(F4Load(&pool->gravity[i]), dt));
+        F4Store(&pool->velocityX[i], velocityX);
+        F4Store(&pool->velocityY[i], velocityY);
+        F4Store(&pool->x[i], F4Add(F4Load(&pool->x[i]), F4Mul(velocityX, dt)));
+        F4Store(&pool->y[i], F4Add(F4Load(&pool->y[i]), F4Mul(velocityY, dt)));
+
+        F4 age = F4Add(F4Load(&pool->age[i]), F4Mul(F4Load(&pool->ageRate[i]), dt));
+        F4Store(&pool->age[i], age);
+        pool->blockBits[i / SIMD_WIDTH] = (unsigned char)(~M4Bits(M4Less(age, one)) & 0xF);
+    }
+}
+
+// Replace particle i with the last one
+static void remove_particle(ParticlePool *pool, int i) {
+    int last = --pool->count;
+    if (i == last) return;
+    pool->x[i] = pool->x[last];
+    pool->y[i] = pool->y[last];
+    pool->velocityX[i] = pool->velocityX[last];
+    pool->velocityY[i] = pool->velocityY[last];
+    pool->gravity[i] = pool->gravity[last];
+    pool->drag[i] = pool->drag[last];
+    pool->age[i] = pool->age[last];
+    pool->ageRate[i] = pool->ageRate[last];
+    pool->effect[i] = pool->effect[last];
+}
+
+// Drop the dead lanes - last block first, so the particle moved into a hole was already checked
+static void remove_dead(ParticlePool *pool) {
+    for (int base = (pool->count - 1) / SIMD_WIDTH * SIMD_WIDTH; base >= 0; base -= SIMD_WIDTH) {
+        int bits = pool->blockBits[base / SIMD_WIDTH];
+        if (base + SIMD_WIDTH > pool->count) bits &= (1 << (pool->count - base)) - 1;  // Lanes past the end hold stale data
+        for (int lane = SIMD_WIDTH - 1; lane >= 0; lane--) {
+            if (bits & (1 << lane)) remove_particle(pool, base + lane);
+        }
+    }
+}
+
+void UpdateParticles(float delta) {
+    if (delta > PARTICLE_MAX_DELTA) delta = PARTICLE_MAX_DELTA;
+
+    // Emitters first, so new particles move this frame too
+    for (int e = 0; e < MAX_PARTICLE_EMITTERS; e++) {
+        ParticleEmitter *emitter = &emitters[e];
+        if (!emitter->active) continue;
+        emitter->pending += emitter->rate * delta;
+        int count = (int)emitter->pending;
+        emitter->pending -= count;
+        EmitParticles(emitter->effect, emitter->position, emitter->angle, count);
+        emitter->timeLeft -= delta;
+        if (emitter->timeLeft <= 0.0f) emitter->active = false;
+    }
+
+    if (particles.count == 0) return;
+    move_particles(&particles, delta);
+    remove_dead(&particles);
+}
+
+static unsigned char lerp_channel(unsigned char from, unsigned char to, float t) {
+    return (unsigned char)(from + (to - from) * t);
+}
+
+// Every particle uses the same texture and depth, so the queue draws them all in one batch
+void DrawParticles(Rectangle view, RenderQueue *queue) {
+    const ParticlePool *pool = &particles;
+    if (pool->count == 0) return;
+    Texture2D texture = *GetTexture(particleTexture);
+    Rectangle source = { 0, 0, (float)texture.width, (float)texture.height };
+
+    for (int i = 0; i < pool->count; i++) {
+        const ParticleStyle *style = &styles[pool->effect[i]];
+        float t = pool->age[i] < 1.0f ? pool->age[i] : 1.0f;
+        float size = style->sizeStart + (style->sizeEnd - style->sizeStart) * t;
+        if (pool->x[i] + size < view.x || pool->x[i] - size > view.x + view.width ||
+            pool->y[i] + size < view.y || pool->y[i] - size > view.y + view.height) continue;
+
+        Color tint = {
+            lerp_channel(style->colorStart.r, style->colorEnd.r, t),
+            lerp_channel(style->colorStart.g, style->colorEnd.g, t),
+            lerp_channel(style->colorStart.b, style->colorEnd.b, t),
+            lerp_channel(style->colorStart.a, style->colorEnd.a, t)
+        };
+        Rectangle dest = { pool->x[i], pool->y[i], size, size };
+        SubmitSprite(queue, RENDER_LAYER_ENTITIES, PARTICLE_DEPTH, texture, source, dest, (Vector2){size / 2, size / 2}, 0.0f, tint);
+    }
+}
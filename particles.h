@@ -0,0 +1,86 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+// Include necessary libraries
+#include "raylib.h"       // Vector2 / Color
+#include "assets.h"       // Particle texture (asset cache handle)
+#include "render_queue.h" // Sorted per-frame draw list
+#include "rng.h"          // Spawn randomness (separate from the game's)
+#include "simd.h"         // SIMD_WIDTH (storage is walked in blocks)
+
+// Particle system constants
+#define PARTICLE_CAPACITY 8192       // Particles alive at once - spawns past it are dropped (multiple of SIMD_WIDTH)
+#define MAX_PARTICLE_EMITTERS 16     // Emitters running at once
+#define PARTICLE_MAX_DELTA 0.1f      // Longest step one update takes (a stalled frame doesn't fling particles)
+#define PARTICLE_DEPTH 3             // Order inside RENDER_LAYER_ENTITIES (over the fireballs)
+
+// Kinds of particles - each has its ParticleStyle
+typedef enum ParticleEffect {
+    PARTICLE_TRAIL,                  // Embers left behind by fireballs
+    PARTICLE_IMPACT,                 // Sparks where a fireball hits
+    PARTICLE_BOSS_DEATH,             // Smoke and fire rising off the dying boss
+    PARTICLE_EFFECT_COUNT
+} ParticleEffect;
+
+// How an effect's particles start out and age
+typedef struct ParticleStyle {
+    float speedMin, speedMax;        // Launch speed in pixels per second
+    float spread;                    // Launch angle varies this much (radians) either side of the direction
+    float lifeMin, lifeMax;          // Seconds
+    float sizeStart, sizeEnd;        // Drawn size in pixels, over the particle's life
+    float gravity;                   // Pixels per second squared (negative rises)
+    float drag;                      // Share of velocity lost per second
+    float jitter;                    // Spawn position varies this much either way
+    Color colorStart, colorEnd;      // Tint over the particle's life (alpha included)
+} ParticleStyle;
+
+/*
+    Particle storage - structure of arrays, fixed size
+    Like the projectile pool, live particles are packed into [0, count) and one that dies is
+    replaced by the last, so the update is a straight 4-lane walk (see simd.h) over arrays that
+    were allocated once. age runs from 0 to 1 over the particle's life; size and colour are
+    looked up from the style by age when drawing, so they cost no storage.
+    Particles are visuals only: they have their own RNG, aren't part of a snapshot or checksum,
+    and move once per rendered frame. The tick spawns bursts and starts emitters (from one
+    thread at a time), the render frame updates and draws.
+*/
+typedef struct ParticlePool {
+    float x[PARTICLE_CAPACITY], y[PARTICLE_CAPACITY];
+    float velocityX[PARTICLE_CAPACITY], velocityY[PARTICLE_CAPACITY];
+    float gravity[PARTICLE_CAPACITY];
+    float drag[PARTICLE_CAPACITY];
+    float age[PARTICLE_CAPACITY];          // 0 = just spawned, 1 = gone
+    float ageRate[PARTICLE_CAPACITY];      // 1 / life
+    unsigned char effect[PARTICLE_CAPACITY];
+    unsigned char blockBits[PARTICLE_CAPACITY / SIMD_WIDTH];  // Per block of SIMD_WIDTH: lanes that died this update
+    int count;
+    Rng rng;
+} ParticlePool;
+
+// Spawns particles of one effect over time at a fixed place
+typedef struct ParticleEmitter {
+    bool active;
+    ParticleEffect effect;
+    Vector2 position;
+    float angle;                     // Launch direction (radians, 0 = right, y down)
+    float rate;                      // Particles per second
+    float pending;                   // Particles owed but not spawned yet (fraction carried over)
+    float timeLeft;                  // Seconds until the emitter stops
+} ParticleEmitter;
+
+// Global variables for particle system
+extern ParticlePool particles;
+
+// Function declarations - particle system lifecycle
+void InitParticles(void);          // Empty pool, no emitters (loads the particle texture)
+void CleanupParticles(void);       // Releases the texture (the pool itself is static)
+
+// Function declarations - spawning (called by the tick)
+int EmitParticles(ParticleEffect effect, Vector2 position, float angle, int count); // Burst now (returns how many fit)
+int StartParticleEmitter(ParticleEffect effect, Vector2 position, float angle, float rate, float duration); // Emitter id (-1 if all are busy)
+
+// Function declarations - per rendered frame
+void UpdateParticles(float delta);                      // Runs emitters, moves and ages particles, drops dead ones
+void DrawParticles(Rectangle view, RenderQueue *queue); // Submits the particles inside view (one texture - one batch)
+
+#endif
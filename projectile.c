@@ -1,187 +1,444 @@
 #include "projectile.h"
-#include "boss.h"
+#include "simd.h"
+#include "jobs.h"
+#include "particles.h"
+#include "raymath.h"
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 // Global variables for projectile system
-Projectile projectiles[MAX_PROJECTILES];  // Array to manage all projectiles
-Texture2D fireTexture;                    // Texture for projectile graphics
+ProjectilePool projectiles;               // All live projectiles, one array per field
+AssetHandle fireTexture;                  // Texture for projectile graphics
+static float trailPending;                // Trail embers owed but not spawned yet (fraction carried over)
+static int trailCursor;                   // Next projectile to leave an ember (round robin)
 
-// Load or generate the fire projectile texture
-void LoadFireTexture() {
-    // Try to load texture from file
-    fireTexture = LoadTexture("fire_projectile.png");
+// Generate a procedural fire image (used when fire_projectile.png is missing)
+static Image GenerateFireImage(void) {
+    // Create a blank 16x16 image
+    Image fireImage = GenImageColor(16, 16, BLANK);
     
-    // If file loading fails (texture width is 0), generate a procedural fire texture
-    if (fireTexture.width == 0) {
-        // Create a blank 16x16 image
-        Image fireImage = GenImageColor(16, 16, BLANK);
-        
-        // Generate a circular fire pattern programmatically
-        for (int y = 0; y < 16; y++) {
-            for (int x = 0; x < 16; x++) {
-                // Calculate distance from center of image
-                float dist = sqrtf((x-8)*(x-8) + (y-8)*(y-8));
-                
-                // Create a radial gradient: orange center, red outer ring
-                if (dist < 8) {
-                    Color fireColor = dist < 4 ? ORANGE : RED;  // Inner circle orange, outer ring red
-                    ImageDrawPixel(&fireImage, x, y, fireColor);
-                }
+    // Generate a circular fire pattern programmatically
+    for (int y = 0; y < 16; y++) {
+        for (int x = 0; x < 16; x++) {
+            // Calculate distance from center of image
+            float dist = sqrtf((x-8)*(x-8) + (y-8)*(y-8));
+            
+            // Create a radial gradient: orange center, red outer ring
+            if (dist < 8) {
+                Color fireColor = dist < 4 ? ORANGE : RED;  // Inner circle orange, outer ring red
+                ImageDrawPixel(&fireImage, x, y, fireColor);
             }
         }
-        
-        // Convert the generated image to a texture
-        fireTexture = LoadTextureFromImage(fireImage);
-        UnloadImage(fireImage);  // Free the image data after creating texture
     }
+    
+    return fireImage;  // The asset cache uploads it (and frees the image)
 }
 
-// Unload the projectile texture from memory
+// Load or generate the fire projectile texture
+void LoadFireTexture() {
+    if (FileExists("fire_projectile.png")) {
+        fireTexture = AcquireTexture("fire_projectile.png");
+    } else {
+        // Generated once and kept resident so restarts don't rebuild it
+        fireTexture = AcquireGeneratedTexture("generated:fire_projectile", GenerateFireImage);
+        KeepTextureResident(fireTexture);
+    }
+}
+
+// Release the projectile texture
 void UnloadFireTexture() {
-    UnloadTexture(fireTexture);
+    ReleaseTexture(fireTexture);
+}
+
+#define PROJECTILE_ARRAY_COUNT 13
+
+// Every per-projectile array, so growing and freeing can't miss one
+static void pool_arrays(ProjectilePool *pool, float **arrays[PROJECTILE_ARRAY_COUNT]) {
+    float **list[PROJECTILE_ARRAY_COUNT] = {
+        &pool->x, &pool->y, &pool->previousX, &pool->previousY, &pool->velocityX, &pool->velocityY,
+        &pool->originX, &pool->scale, &pool->rotation, &pool->spin, &pool->phaseSin, &pool->phaseCos,
+        &pool->damage
+    };
+    memcpy(arrays, list, sizeof(list));
+}
+
+// Grow the arrays to match the entity pool. New space is zeroed - the kernels read whole
+// blocks, so the tail lanes past count must hold plain numbers
+static bool grow_arrays(ProjectilePool *pool, int capacity) {
+    float **arrays[PROJECTILE_ARRAY_COUNT];
+    pool_arrays(pool, arrays);
+    for (int a = 0; a < PROJECTILE_ARRAY_COUNT; a++) {
+        float *grown = realloc(*arrays[a], capacity * sizeof(float));
+        if (!grown) {
+            TraceLog(LOG_WARNING, "PROJECTILE: Out of memory growing to %d projectiles", capacity);
+            return false;   // Arrays already grown keep their size - the next attempt redoes the rest
+        }
+        memset(grown + pool->capacity, 0, (capacity - pool->capacity) * sizeof(float));
+        *arrays[a] = grown;
+    }
+    unsigned char *blockBits = realloc(pool->blockBits, capacity / SIMD_WIDTH);
+    if (!blockBits) {
+        TraceLog(LOG_WARNING, "PROJECTILE: Out of memory growing to %d projectiles", capacity);
+        return false;
+    }
+    pool->blockBits = blockBits;
+    pool->capacity = capacity;
+    return true;
 }
 
-// Initialize all projectiles to inactive state
+static void free_arrays(ProjectilePool *pool) {
+    float **arrays[PROJECTILE_ARRAY_COUNT];
+    pool_arrays(pool, arrays);
+    for (int a = 0; a < PROJECTILE_ARRAY_COUNT; a++) {
+        free(*arrays[a]);
+        *arrays[a] = NULL;
+    }
+    free(pool->blockBits);
+    pool->blockBits = NULL;
+    pool->capacity = 0;
+}
+
+// Create an empty pool (a restart frees the previous one first)
 void InitProjectiles() {
     LoadFireTexture();  // Ensure texture is loaded
-    
-    // Initialize each projectile in the array
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
-        projectiles[i].active = false;        // Start inactive
-        projectiles[i].scale = 1.0f;          // Default scale
-        projectiles[i].rotation = 0.0f;       // No rotation
-        projectiles[i].initialPosition = (Vector2){0, 0};  // Initialize starting position
+    free_arrays(&projectiles);
+    FreeEntityPool(&projectiles.ids);
+    if (!InitEntityPool(&projectiles.ids, PROJECTILE_INITIAL_CAPACITY) ||
+        !grow_arrays(&projectiles, PROJECTILE_INITIAL_CAPACITY)) {
+        TraceLog(LOG_WARNING, "PROJECTILE: Could not allocate the pool - spawns will fail");
     }
+    projectiles.spawned = 0;
+    projectiles.effectTime = 0.0;  // Effects run on simulation time, so a run replays the same at any speed
+    projectiles.hitSize = GetTexture(fireTexture)->width * 0.5f;
+}
+
+// Append a projectile at the end of the packed range
+EntityHandle SpawnProjectile(Vector2 position, Vector2 velocity) {
+    ProjectilePool *pool = &projectiles;
+    EntityHandle handle;
+    int i = SpawnEntity(&pool->ids, &handle);
+    if (i < 0) return NULL_ENTITY;
+    int capacity = (pool->ids.capacity + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH;  // Whole blocks
+    if (capacity > pool->capacity && !grow_arrays(pool, capacity)) {
+        DespawnEntityAt(&pool->ids, i);  // It was the last item, so nothing moves
+        return NULL_ENTITY;
+    }
+
+    pool->x[i] = position.x;
+    pool->y[i] = position.y;
+    pool->previousX[i] = position.x;   // Nothing to interpolate from yet
+    pool->previousY[i] = position.y;
+    pool->velocityX[i] = velocity.x;
+    pool->velocityY[i] = velocity.y;
+    pool->originX[i] = position.x;     // Starting point for the range limit
+    pool->scale[i] = 1.5f;             // Slightly larger scale
+    pool->rotation[i] = 0.0f;          // Start with no rotation
+    pool->spin[i] = velocity.x > 0 ? PROJECTILE_SPIN : -PROJECTILE_SPIN;  // Spin with the direction of travel
+    pool->damage[i] = PROJECTILE_DAMAGE;
+
+    // Wobble phase - consecutive shots are out of step with each other
+    float phase = (float)(pool->spawned++ % 64);
+    pool->phaseSin[i] = sinf(phase);
+    pool->phaseCos[i] = cosf(phase);
+    return handle;
 }
 
 // Create and fire a new projectile from the character's position
-void ShootProjectile(Animation *anim) {
-    // Find an available (inactive) projectile slot
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
-        if (!projectiles[i].active) {
-            // Activate this projectile
-            projectiles[i].active = true;
-            projectiles[i].damage = PROJECTILE_DAMAGE;  // Set standard damage
-            
-            // Position projectile at character's hand/weapon position
-            projectiles[i].position = (Vector2){
-                anim->position.x + (anim->facingRight ? FRAME_WIDTH * anim->scale : 0),  // Right or left side
-                anim->position.y + (FRAME_HEIGHT * anim->scale) / 2  // Middle of character height
-            };
-            
-            projectiles[i].initialPosition = projectiles[i].position;  // Store starting point for range calculation
-            
-            // Set velocity based on character's facing direction
-            projectiles[i].velocity = (Vector2){
-                anim->facingRight ? PROJECTILE_SPEED : -PROJECTILE_SPEED,  // Right or left movement
-                0  // No vertical movement initially
-            };
-            
-            projectiles[i].scale = 1.5f;     // Slightly larger scale
-            projectiles[i].rotation = 0.0f;  // Start with no rotation
-            break;  // Only create one projectile per shot
+void ShootProjectile(const Transform *shooter) {
+    // Position projectile at character's hand/weapon position
+    Vector2 position = {
+        shooter->position.x + (shooter->facingRight ? FRAME_WIDTH * shooter->scale : 0),  // Right or left side
+        shooter->position.y + (FRAME_HEIGHT * shooter->scale) / 2  // Middle of character height
+    };
+    // Velocity based on character's facing direction (no vertical movement initially)
+    Vector2 velocity = { shooter->facingRight ? PROJECTILE_SPEED : -PROJECTILE_SPEED, 0 };
+    SpawnProjectile(position, velocity);
+}
+
+// Despawn the projectile at index i; the pool moves the last one into it, the arrays follow
+static void remove_projectile(ProjectilePool *pool, int i) {
+    DespawnEntityAt(&pool->ids, i);
+    int last = pool->ids.count;
+    if (i == last) return;
+    pool->x[i] = pool->x[last];
+    pool->y[i] = pool->y[last];
+    pool->previousX[i] = pool->previousX[last];
+    pool->previousY[i] = pool->previousY[last];
+    pool->velocityX[i] = pool->velocityX[last];
+    pool->velocityY[i] = pool->velocityY[last];
+    pool->originX[i] = pool->originX[last];
+    pool->scale[i] = pool->scale[last];
+    pool->rotation[i] = pool->rotation[last];
+    pool->spin[i] = pool->spin[last];
+    pool->phaseSin[i] = pool->phaseSin[last];
+    pool->phaseCos[i] = pool->phaseCos[last];
+    pool->damage[i] = pool->damage[last];
+}
+
+// Remove one projectile by handle (false if it already despawned)
+bool DespawnProjectile(EntityHandle handle) {
+    int i = GetEntityIndex(&projectiles.ids, handle);
+    if (i < 0) return false;
+    remove_projectile(&projectiles, i);
+    return true;
+}
+
+/*
+    Remove every lane set in a block's mask bits. Blocks have to be visited last to first: the
+    projectile moved into a freed slot then always comes from a block that was already checked.
+    Returns the number removed
+*/
+static int remove_block(ProjectilePool *pool, int base, int bits) {
+    int removed = 0;
+    if (base + SIMD_WIDTH > pool->ids.count) bits &= (1 << (pool->ids.count - base)) - 1;  // Lanes past the end hold stale data
+    for (int lane = SIMD_WIDTH - 1; lane >= 0; lane--) {
+        if (bits & (1 << lane)) {
+            remove_projectile(pool, base + lane);
+            removed++;
         }
     }
+    return removed;
 }
 
-// Update all active projectiles - movement, collision, effects
-void UpdateProjectiles(float delta, tmx_map *map, Boss *boss) {
-    // Calculate map boundaries for collision detection
-    float map_w = map->width * map->tile_width;
-    float map_h = map->height * map->tile_height;
-    
-    // Process each projectile in the array
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
-        if (projectiles[i].active) {
-            // BASIC MOVEMENT: Apply velocity to position
-            projectiles[i].position.x += projectiles[i].velocity.x * delta;
-            projectiles[i].position.y += projectiles[i].velocity.y * delta;
-            
-            // FIRE EFFECT: Add subtle vertical wobble using sine wave
-            projectiles[i].position.y += sinf(GetTime() * 10.0f + i) * 0.5f;
-            
-            // ROTATION EFFECT: Spin projectile based on direction
-            projectiles[i].rotation += (projectiles[i].velocity.x > 0 ? 10.0f : -10.0f) * delta;
-            
-            // PULSATING SCALE: Make fireball pulse in size
-            projectiles[i].scale = 1.5f + sinf(GetTime() * 15.0f + i) * 0.3f;
-
-            // BOSS COLLISION DETECTION
-            if (!boss->isDead) {  // Only check collision if boss is alive
-                // Calculate boss collision rectangle
-                float bossW = (boss->skillRight.width / 6) * 1.8f;
-                float bossH = boss->skillRight.height * 1.8f;
-                Rectangle bossRect = { 
-                    boss->position.x, 
-                    boss->position.y, 
-                    bossW, 
-                    bossH 
-                };
-                
-                // Calculate projectile collision rectangle (scaled texture size)
-                float projSize = fireTexture.width * projectiles[i].scale * 0.5f;
-                Rectangle projRect = { 
-                    projectiles[i].position.x - projSize/2,  // Center the collision box
-                    projectiles[i].position.y - projSize/2, 
-                    projSize, 
-                    projSize 
-                };
-                
-                // Check if projectile collides with boss
-                if (CheckCollisionRecs(bossRect, projRect)) {
-                    projectiles[i].active = false;  // Deactivate projectile
-                    boss->health -= projectiles[i].damage;  // Apply damage to boss
-                    if (boss->health < 0) boss->health = 0;  // Clamp health at zero
-                }
-            }
+// Remove the lanes marked in blockBits - serial, last block first (see remove_block)
+static int remove_marked(ProjectilePool *pool) {
+    int removed = 0;
+    for (int base = (pool->ids.count - 1) / SIMD_WIDTH * SIMD_WIDTH; base >= 0; base -= SIMD_WIDTH) {
+        int bits = pool->blockBits[base / SIMD_WIDTH];
+        if (bits) removed += remove_block(pool, base, bits);
+    }
+    return removed;
+}
 
-            // MAP BOUNDARY COLLISION: Deactivate if outside map
-            if (projectiles[i].position.x < 0 || projectiles[i].position.x > map_w ||
-                projectiles[i].position.y < 0 || projectiles[i].position.y > map_h) {
-                projectiles[i].active = false;
-            }
-            
-            // RANGE LIMIT: Auto-despawn after traveling 1000 pixels
-            float travelDistance = fabsf(projectiles[i].position.x - projectiles[i].initialPosition.x);
-            if (travelDistance > 1000.0f) {
-                projectiles[i].active = false;
-            }
+// Tick-wide terms for the movement batches
+typedef struct MoveKernel {
+    ProjectilePool *pool;
+    F4 wobbleSin, wobbleCos;
+    F4 pulseSin, pulseCos;
+    F4 dt;
+    F4 wobbleStep;
+    F4 mapW, mapH;
+} MoveKernel;
+
+/*
+    Movement batch - projectiles [begin, end), 4 lanes at a time:
+        -previous position saved for interpolation
+        -velocity, wobble and spin applied
+        -scale pulse
+        -marked for removal when outside the map or past their range
+    A block's mark only depends on that block, so marking everything first and removing afterwards
+    (last block first) drops exactly what a block-by-block cull did.
+    Lanes past count (the last block's tail) are updated too - harmless, they hold stale values
+    (capacity is always a multiple of SIMD_WIDTH, so the tail is inside the arrays)
+*/
+static void move_batch(void *data, int begin, int end) {
+    const MoveKernel *k = data;
+    ProjectilePool *pool = k->pool;
+    F4 pulseBase = F4Set(1.5f);
+    F4 pulseAmount = F4Set(0.3f);
+    F4 zero = F4Set(0.0f);
+    F4 range = F4Set(PROJECTILE_RANGE);
+
+    for (int i = begin; i < end; i += SIMD_WIDTH) {
+        F4 x = F4Load(&pool->x[i]);
+        F4 y = F4Load(&pool->y[i]);
+        F4Store(&pool->previousX[i], x);
+        F4Store(&pool->previousY[i], y);
+
+        F4 phaseSin = F4Load(&pool->phaseSin[i]);
+        F4 phaseCos = F4Load(&pool->phaseCos[i]);
+
+        // Movement plus the vertical wobble: sin(10t + phase)
+        F4 wobble = F4Add(F4Mul(k->wobbleSin, phaseCos), F4Mul(k->wobbleCos, phaseSin));
+        x = F4Add(x, F4Mul(F4Load(&pool->velocityX[i]), k->dt));
+        y = F4Add(y, F4Add(F4Mul(F4Load(&pool->velocityY[i]), k->dt), F4Mul(wobble, k->wobbleStep)));
+        F4Store(&pool->x[i], x);
+        F4Store(&pool->y[i], y);
+
+        // Spin, and the pulsating scale: 1.5 + 0.3 * sin(15t + phase)
+        F4Store(&pool->rotation[i], F4Add(F4Load(&pool->rotation[i]), F4Mul(F4Load(&pool->spin[i]), k->dt)));
+        F4 pulse = F4Add(F4Mul(k->pulseSin, phaseCos), F4Mul(k->pulseCos, phaseSin));
+        F4Store(&pool->scale[i], F4Add(pulseBase, F4Mul(pulse, pulseAmount)));
+
+        // Cull: outside the map, or further than PROJECTILE_RANGE from where it was fired
+        M4 outside = M4Or(M4Or(M4Less(x, zero), M4Greater(x, k->mapW)), M4Or(M4Less(y, zero), M4Greater(y, k->mapH)));
+        M4 spent = M4Greater(F4Abs(F4Sub(x, F4Load(&pool->originX[i]))), range);
+        pool->blockBits[i / SIMD_WIDTH] = (unsigned char)M4Bits(M4Or(outside, spent));
+    }
+}
+
+// Update every projectile - movement, effects, despawning (hits are HitProjectiles)
+void UpdateProjectiles(float delta, const Level *level) {
+    ProjectilePool *pool = &projectiles;
+    pool->effectTime += delta;
+    if (pool->ids.count == 0) return;
+
+    // Tick-wide terms - the only sin/cos calls left
+    MoveKernel kernel = {
+        .pool = pool,
+        .wobbleSin = F4Set((float)sin(pool->effectTime * 10.0)),
+        .wobbleCos = F4Set((float)cos(pool->effectTime * 10.0)),
+        .pulseSin = F4Set((float)sin(pool->effectTime * 15.0)),
+        .pulseCos = F4Set((float)cos(pool->effectTime * 15.0)),
+        .dt = F4Set(delta),
+        .wobbleStep = F4Set(0.5f * delta * PROJECTILE_WOBBLE_STEP_RATE),  // Per-step offset, scaled to the tick length
+        .mapW = F4Set(GetLevelPixelWidth(level)),
+        .mapH = F4Set(GetLevelPixelHeight(level)),
+    };
+    ParallelFor(move_batch, &kernel, pool->ids.count, PROJECTILE_JOB_BATCH);
+    remove_marked(pool);
+}
+
+// Target box for the hit batches
+typedef struct HitKernel {
+    ProjectilePool *pool;
+    F4 left, right, top, bottom;
+    F4 halfSize;
+} HitKernel;
+
+// Hit batch - marks the projectiles in [begin, end) overlapping the target
+static void hit_batch(void *data, int begin, int end) {
+    const HitKernel *k = data;
+    ProjectilePool *pool = k->pool;
+    for (int i = begin; i < end; i += SIMD_WIDTH) {
+        F4 x = F4Load(&pool->x[i]);
+        F4 y = F4Load(&pool->y[i]);
+        F4 half = F4Mul(F4Load(&pool->scale[i]), k->halfSize);
+        M4 overlapX = M4And(M4Less(F4Sub(x, half), k->right), M4Greater(F4Add(x, half), k->left));
+        M4 overlapY = M4And(M4Less(F4Sub(y, half), k->bottom), M4Greater(F4Add(y, half), k->top));
+        pool->blockBits[i / SIMD_WIDTH] = (unsigned char)M4Bits(M4And(overlapX, overlapY));
+    }
+}
+
+/*
+    Batch hit test - one target box against every projectile, 4 at a time.
+    A projectile's box is hitSize * scale wide, centred on it. Overlap is strict on every side,
+    like CheckCollisionRecs. Each hit deals its damage and the projectile is spent
+*/
+int HitProjectiles(Rectangle target, Health *health) {
+    ProjectilePool *pool = &projectiles;
+    if (pool->ids.count == 0) return 0;
+
+    HitKernel kernel = {
+        .pool = pool,
+        .left = F4Set(target.x),
+        .right = F4Set(target.x + target.width),
+        .top = F4Set(target.y),
+        .bottom = F4Set(target.y + target.height),
+        .halfSize = F4Set(pool->hitSize * 0.5f),
+    };
+    ParallelFor(hit_batch, &kernel, pool->ids.count, PROJECTILE_JOB_BATCH);
+
+    // Damage first, in index order - removing lanes moves other projectiles into them
+    int count = pool->ids.count;
+    for (int base = 0; base < count; base += SIMD_WIDTH) {
+        int bits = pool->blockBits[base / SIMD_WIDTH];
+        if (!bits) continue;
+        if (base + SIMD_WIDTH > count) bits &= (1 << (count - base)) - 1;
+        for (int lane = 0; lane < SIMD_WIDTH; lane++) {
+            if (!(bits & (1 << lane))) continue;
+            int i = base + lane;
+            health->current -= (int)pool->damage[i];
+            // Sparks fly back the way the fireball came
+            EmitParticles(PARTICLE_IMPACT, (Vector2){pool->x[i], pool->y[i]}, pool->velocityX[i] < 0 ? 0.0f : PI, PROJECTILE_IMPACT_PARTICLES);
         }
     }
+    int hits = remove_marked(pool);
+    if (health->current < 0) health->current = 0;  // Clamp health at zero
+    return hits;
 }
 
-// Draw all active projectiles with visual effects
-void DrawProjectiles() {
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
-        if (projectiles[i].active) {
-            // Set up texture drawing parameters
-            Vector2 origin = { fireTexture.width/2, fireTexture.height/2 };  // Rotate around center
-            Rectangle source = { 0, 0, fireTexture.width, fireTexture.height };  // Full texture
-            Rectangle dest = {
-                projectiles[i].position.x,
-                projectiles[i].position.y,
-                fireTexture.width * projectiles[i].scale,   // Scaled width
-                fireTexture.height * projectiles[i].scale   // Scaled height
-            };
-            
-            // Flip texture based on movement direction (for consistency)
-            if (projectiles[i].velocity.x < 0) {
-                source.width = -source.width;  // Flip horizontally
-            }
-            
-            // Draw main fire texture with orange tint
-            Color fireTint = (Color){255, 165, 0, 255}; // Orange color
-            DrawTexturePro(fireTexture, source, dest, origin, projectiles[i].rotation, fireTint);
-            
-            // Add glowing overlay effect (semi-transparent yellow)
-            DrawTexturePro(fireTexture, source, dest, origin, projectiles[i].rotation, 
-                          Fade(YELLOW, 0.3f + sinf(GetTime() * 20.0f) * 0.2f));  // Pulsating alpha
+/*
+    Trail embers - PROJECTILE_TRAIL_RATE per fireball per second, handed out round robin so every
+    fireball trails however many there are. Once the particle pool is full the rest are dropped,
+    so the cost stays bounded
+*/
+void EmitProjectileTrails(float delta) {
+    const ProjectilePool *pool = &projectiles;
+    if (pool->ids.count == 0) {
+        trailPending = 0.0f;
+        return;
+    }
+    if (delta > PARTICLE_MAX_DELTA) delta = PARTICLE_MAX_DELTA;
+    trailPending += pool->ids.count * PROJECTILE_TRAIL_RATE * delta;
+    int budget = (int)trailPending;
+    trailPending -= budget;
+    if (budget > PARTICLE_CAPACITY - particles.count) budget = PARTICLE_CAPACITY - particles.count;
+
+    for (int n = 0; n < budget; n++) {
+        if (trailCursor >= pool->ids.count) trailCursor = 0;
+        int i = trailCursor++;
+        float angle = atan2f(-pool->velocityY[i], -pool->velocityX[i]);  // Drifting back along the path
+        EmitParticles(PARTICLE_TRAIL, (Vector2){pool->x[i], pool->y[i]}, angle, 1);
+    }
+}
+
+// Draw the projectiles inside view with visual effects
+void DrawProjectiles(float alpha, Rectangle view, RenderQueue *queue) {
+    const ProjectilePool *pool = &projectiles;
+    Texture2D fire = *GetTexture(fireTexture);
+    Color fireTint = (Color){255, 165, 0, 255}; // Orange color
+    float margin = fire.width * 2.0f;           // Largest half extent of a scaled, rotated sprite
+
+    for (int i = 0; i < pool->ids.count; i++) {
+        Vector2 position = Vector2Lerp((Vector2){pool->previousX[i], pool->previousY[i]}, (Vector2){pool->x[i], pool->y[i]}, alpha);
+        if (position.x < view.x - margin || position.x > view.x + view.width + margin ||
+            position.y < view.y - margin || position.y > view.y + view.height + margin) continue;
+
+        // Set up texture drawing parameters
+        Vector2 origin = { fire.width/2, fire.height/2 };  // Rotate around center
+        Rectangle source = { 0, 0, fire.width, fire.height };  // Full texture
+        Rectangle dest = {
+            position.x,
+            position.y,
+            fire.width * pool->scale[i],   // Scaled width
+            fire.height * pool->scale[i]   // Scaled height
+        };
+
+        // Flip texture based on movement direction (for consistency)
+        if (pool->velocityX[i] < 0) {
+            source.width = -source.width;  // Flip horizontally
         }
+
+        // Draw main fire texture with orange tint (the glow around it is trail particles)
+        SubmitSprite(queue, RENDER_LAYER_ENTITIES, 2, fire, source, dest, origin, pool->rotation[i], fireTint);
+    }
+}
+
+// Counters, the handle tables, then every array up to count (tail lanes are recomputed anyway)
+void SaveProjectiles(Snapshot *snapshot) {
+    const ProjectilePool *pool = &projectiles;
+    WriteSnapshot(snapshot, &pool->spawned, sizeof(pool->spawned));
+    WriteSnapshot(snapshot, &pool->effectTime, sizeof(pool->effectTime));
+    SaveEntityPool(&pool->ids, snapshot);
+    float **arrays[PROJECTILE_ARRAY_COUNT];
+    pool_arrays((ProjectilePool *)pool, arrays);
+    for (int a = 0; a < PROJECTILE_ARRAY_COUNT; a++) {
+        WriteSnapshot(snapshot, *arrays[a], pool->ids.count * sizeof(float));
     }
 }
 
+// Arrays grow to the saved pool if needed and are never shrunk
+bool LoadProjectiles(SnapshotReader *reader) {
+    ProjectilePool *pool = &projectiles;
+    if (!ReadSnapshotBytes(reader, &pool->spawned, sizeof(pool->spawned)) ||
+        !ReadSnapshotBytes(reader, &pool->effectTime, sizeof(pool->effectTime)) ||
+        !LoadEntityPool(&pool->ids, reader)) return false;
+    int capacity = (pool->ids.capacity + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH;
+    if (capacity > pool->capacity && !grow_arrays(pool, capacity)) return false;
+
+    float **arrays[PROJECTILE_ARRAY_COUNT];
+    pool_arrays(pool, arrays);
+    for (int a = 0; a < PROJECTILE_ARRAY_COUNT; a++) {
+        if (!ReadSnapshotBytes(reader, *arrays[a], pool->ids.count * sizeof(float))) return false;
+    }
+    return true;
+}
+
 // Clean up projectile system resources
 void CleanupProjectiles() {
+    free_arrays(&projectiles);
+    FreeEntityPool(&projectiles.ids);
     UnloadFireTexture();  // Free the texture memory
-}
\ No newline at end of file
+}
@@ -3,29 +3,55 @@
 
 // Include necessary libraries for projectile functionality
 #include "raylib.h"      // Graphics, audio, and input functionality
-#include "tmx.h"         // Tilemap loading and collision detection
+#include "level.h"       // Level size for despawn bounds
 #include "character.h"   // Character/player definitions (for shooting)
-#include "boss.h"        // Boss enemy definitions (for dealing damage)
+#include "ecs.h"         // Transform (shooter) and Health (target) components
+#include "render_queue.h" // Sorted per-frame draw list
+#include "entity_pool.h" // Handles and packing of live projectiles
 
 // Projectile system constants
-#define MAX_PROJECTILES 50       // Maximum number of active projectiles at once
+#define PROJECTILE_INITIAL_CAPACITY 256  // Pool size at start - it doubles when full (multiple of SIMD_WIDTH)
 #define PROJECTILE_SPEED 300.0f  // Base speed of projectiles in pixels per second
 #define PROJECTILE_DAMAGE 200    // Damage dealt by each projectile to boss
+#define PROJECTILE_RANGE 1000.0f // Horizontal distance a projectile flies before it despawns
+#define PROJECTILE_SPIN 10.0f    // Rotation speed (radians per second, sign follows the direction)
+#define PROJECTILE_WOBBLE_STEP_RATE 60.0f // The wobble offset was tuned as a per-frame step at 60 FPS
+#define PROJECTILE_TRAIL_RATE 40.0f   // Trail embers per projectile per second (fewer once the particle pool is full)
+#define PROJECTILE_IMPACT_PARTICLES 12 // Sparks in a hit's burst
+#define PROJECTILE_JOB_BATCH 4096 // Projectiles per job batch (multiple of SIMD_WIDTH; fewer run inline)
 
-// Projectile structure - represents a single fired projectile
-typedef struct Projectile {
-    bool active;           // Whether this projectile is currently active and moving
-    Vector2 position;      // Current world coordinates of the projectile
-    Vector2 velocity;      // Movement direction and speed (x, y components)
-    Vector2 initialPosition;  // Starting position (useful for range calculations or effects)
-    float damage;          // Damage this projectile deals (can vary per projectile)
-    float scale;           // Size multiplier for drawing the projectile
-    float rotation;        // Rotation angle for projectile sprite (for directional effects)
-} Projectile;
+/*
+    Projectile storage - structure of arrays
+    Every field is its own array, and live projectiles are packed into [0, ids.count): a despawned
+    one is replaced by the last (the entity pool decides, the arrays follow). The per-tick work
+    (movement, wobble, culling, hits against the boss) then walks plain float arrays 4 lanes at
+    a time (see simd.h) with no active flags to skip. Arrays grow with the pool, so a shot is
+    never dropped for lack of room.
+    The wobble used to call sinf twice per projectile per tick. Each projectile now keeps
+    sin/cos of its phase, so with the tick's sin/cos the wobble is a few multiply-adds:
+        sin(t + phase) = sin t * cos phase + cos t * sin phase
+*/
+typedef struct ProjectilePool {
+    EntityPool ids;             // Handles, and which dense index each projectile is at
+    int capacity;               // Length of every array below (follows ids.capacity)
+    float *x, *y;               // Position
+    float *previousX, *previousY; // Position before the last tick (drawing interpolates between the two)
+    float *velocityX, *velocityY; // Pixels per second
+    float *originX;             // Spawn x (range limit)
+    float *scale;               // Size multiplier for drawing and hits (pulses)
+    float *rotation;            // Sprite rotation
+    float *spin;                // Rotation speed
+    float *phaseSin, *phaseCos; // sin / cos of the wobble phase
+    float *damage;              // Damage dealt on a hit
+    unsigned char *blockBits;   // Per block of SIMD_WIDTH: lanes to remove (batch jobs fill it, removal is serial)
+    unsigned int spawned;       // Projectiles spawned since InitProjectiles (gives each its phase)
+    double effectTime;          // Simulated seconds since InitProjectiles (wobble / pulse phase)
+    float hitSize;              // Hit box side at scale 1 (half the fire texture width)
+} ProjectilePool;
 
 // Global variables for projectile system
-extern Projectile projectiles[MAX_PROJECTILES];  // Array storing all projectiles
-extern Texture2D fireTexture;                    // Texture used for projectile graphics
+extern ProjectilePool projectiles;               // All live projectiles
+extern AssetHandle fireTexture;                  // Texture used for projectile graphics (asset cache handle)
 
 // Function declarations - projectile system management
 
@@ -34,10 +60,16 @@ void LoadFireTexture();     // Loads the projectile texture from file
 void UnloadFireTexture();   // Unloads the projectile texture from memory
 
 // Projectile system lifecycle functions
-void InitProjectiles();     // Initializes all projectiles to inactive state
-void ShootProjectile(Animation *anim);  // Creates a new projectile from character position
-void UpdateProjectiles(float delta, tmx_map *map, Boss *boss);  // Updates all active projectiles
-void DrawProjectiles();     // Renders all active projectiles to the screen
-void CleanupProjectiles();  // Cleans up all projectile resources
+void InitProjectiles();     // Creates an empty pool
+EntityHandle SpawnProjectile(Vector2 position, Vector2 velocity); // Adds a projectile (NULL_ENTITY only if memory runs out)
+bool DespawnProjectile(EntityHandle handle);              // Removes a projectile (false if it is already gone)
+void ShootProjectile(const Transform *shooter);  // Creates a new projectile from a character's hand
+void UpdateProjectiles(float delta, const Level *level);  // Moves every projectile and despawns out-of-range ones
+int HitProjectiles(Rectangle target, Health *health);     // Projectiles overlapping target damage it and despawn (returns hits)
+void EmitProjectileTrails(float delta);                   // Leaves trail particles behind the projectiles (once per rendered frame)
+void DrawProjectiles(float alpha, Rectangle view, RenderQueue *queue);  // Submits projectiles inside view (alpha: 0 = previous tick, 1 = last tick)
+void SaveProjectiles(Snapshot *snapshot);                 // Appends the pool to a snapshot
+bool LoadProjectiles(SnapshotReader *reader);             // Replaces the pool with a saved one (false if the snapshot is short)
+void CleanupProjectiles();  // Frees the pool and the texture
 
-#endif
\ No newline at end of file
+#endif
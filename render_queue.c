@@ -0,0 +1,66 @@
+#include "render_queue.h"
+#include <stdlib.h>
+
+/*
+    Sort key layout (most significant first)
+        8 bits  layer
+        16 bits depth (biased so negative depths sort before 0)
+        32 bits texture id
+    Submission order is compared separately when keys tie (qsort isn't stable, and a frame can
+    queue more items than would fit next to the rest of the key)
+*/
+static uint64_t make_key(RenderLayer layer, int depth, unsigned int textureId) {
+    return ((uint64_t)(layer & 0xFF) << 48) |
+           ((uint64_t)((depth + 0x8000) & 0xFFFF) << 32) |
+           (uint64_t)textureId;
+}
+
+static int compare_items(const void *a, const void *b) {
+    const RenderItem *ia = a, *ib = b;
+    if (ia->key != ib->key) return (ia->key > ib->key) - (ia->key < ib->key);
+    return (ia->order > ib->order) - (ia->order < ib->order);
+}
+
+void SubmitSprite(RenderQueue *queue, RenderLayer layer, int depth, Texture2D texture,
+                  Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    if (tint.a == 0 || texture.id == 0) return; // Nothing would show up
+
+    if (queue->count == queue->capacity) {
+        int capacity = queue->capacity ? queue->capacity * 2 : 256;
+        RenderItem *items = realloc(queue->items, (size_t)capacity * sizeof(RenderItem));
+        if (!items) return;  // Out of memory - this sprite isn't drawn
+        queue->items = items;
+        queue->capacity = capacity;
+    }
+    queue->items[queue->count] = (RenderItem){
+        make_key(layer, depth, texture.id), (uint32_t)queue->count,
+        texture, source, dest, origin, rotation, tint
+    };
+    queue->count++;
+}
+
+/*
+    Draw the queue in key order.
+    raylib keeps appending quads to the same draw call until the bound texture changes,
+    so after sorting every run of items sharing a texture goes out as one draw call
+*/
+void FlushRenderQueue(RenderQueue *queue) {
+    qsort(queue->items, queue->count, sizeof(RenderItem), compare_items);
+
+    unsigned int boundTexture = 0;
+    queue->textureSwitches = 0;
+    for (int i = 0; i < queue->count; i++) {
+        RenderItem *item = &queue->items[i];
+        if (item->texture.id != boundTexture) {
+            boundTexture = item->texture.id;
+            queue->textureSwitches++;
+        }
+        DrawTexturePro(item->texture, item->source, item->dest, item->origin, item->rotation, item->tint);
+    }
+    queue->count = 0;
+}
+
+void FreeRenderQueue(RenderQueue *queue) {
+    free(queue->items);
+    *queue = (RenderQueue){0};
+}
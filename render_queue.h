@@ -0,0 +1,49 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+// Include necessary libraries
+#include "raylib.h"  // Texture2D, Rectangle, Color types
+#include <stdint.h>
+
+// Draw layers, back to front (highest priority part of the sort key)
+typedef enum RenderLayer {
+    RENDER_LAYER_BACKGROUND = 0,   // Parallax backgrounds
+    RENDER_LAYER_WORLD,            // Static tile chunks
+    RENDER_LAYER_ENTITIES,         // Player, boss, projectiles
+    RENDER_LAYER_FOREGROUND        // Tile layers drawn over entities (grass)
+} RenderLayer;
+
+// One queued textured quad (same parameters as DrawTexturePro)
+typedef struct RenderItem {
+    uint64_t key;          // layer | depth | texture
+    uint32_t order;        // Submission order (breaks ties between equal keys)
+    Texture2D texture;
+    Rectangle source;
+    Rectangle dest;
+    Vector2 origin;
+    float rotation;
+    Color tint;
+} RenderItem;
+
+// Per-frame draw list - filled by the subsystems, sorted and issued by FlushRenderQueue
+typedef struct RenderQueue {
+    RenderItem *items;
+    int count;
+    int capacity;
+    int textureSwitches;   // Texture changes in the last flush (each one ends a raylib draw call)
+} RenderQueue;
+
+// Function declarations - render queue
+
+/*
+    Queue a quad.
+    Items sort by layer, then depth (lower first) inside the layer, then texture, so quads that
+    share a texture end up next to each other. Equal keys keep their submission order
+*/
+void SubmitSprite(RenderQueue *queue, RenderLayer layer, int depth, Texture2D texture,
+                  Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
+
+void FlushRenderQueue(RenderQueue *queue);   // Sort, draw everything and empty the queue
+void FreeRenderQueue(RenderQueue *queue);    // Release item storage
+
+#endif
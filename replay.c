@@ -0,0 +1,111 @@
+#include "replay.h"
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t pack_input(CharacterInput input) {
+    return (input.left ? REPLAY_INPUT_LEFT : 0) | (input.right ? REPLAY_INPUT_RIGHT : 0) |
+           (input.jump ? REPLAY_INPUT_JUMP : 0) | (input.shoot ? REPLAY_INPUT_SHOOT : 0);
+}
+
+static CharacterInput unpack_input(uint8_t bits) {
+    return (CharacterInput){
+        (bits & REPLAY_INPUT_LEFT) != 0,
+        (bits & REPLAY_INPUT_RIGHT) != 0,
+        (bits & REPLAY_INPUT_JUMP) != 0,
+        (bits & REPLAY_INPUT_SHOOT) != 0
+    };
+}
+
+bool StartReplayRecording(Replay *replay, const char *path, const char *levelPath, uint32_t seed, uint32_t tickRate) {
+    memset(replay, 0, sizeof(*replay));
+    replay->header.magic = REPLAY_MAGIC;
+    replay->header.version = REPLAY_VERSION;
+    replay->header.seed = seed;
+    replay->header.tickRate = tickRate;
+    strncpy(replay->header.level, levelPath, LEVEL_PATH_LENGTH - 1);
+    replay->recording = true;
+    replay->divergedAt = -1;
+
+    replay->file = fopen(path, "wb");
+    if (!replay->file) {
+        TraceLog(LOG_WARNING, "REPLAY: Cannot write %s", path);
+        return false;
+    }
+    fwrite(&replay->header, sizeof(replay->header), 1, replay->file);
+    return true;
+}
+
+void RecordReplayTick(Replay *replay, CharacterInput input, uint32_t checksum) {
+    if (!replay->file) return;
+    uint8_t record[REPLAY_TICK_SIZE];
+    record[0] = pack_input(input);
+    memcpy(record + 1, &checksum, sizeof(checksum));
+    fwrite(record, REPLAY_TICK_SIZE, 1, replay->file);
+    replay->tickCount++;
+}
+
+bool LoadReplay(Replay *replay, const char *path, uint32_t tickRate) {
+    memset(replay, 0, sizeof(*replay));
+    replay->divergedAt = -1;
+
+    FILE *file = fopen(path, "rb");
+    if (!file) return false;
+    if (fread(&replay->header, sizeof(replay->header), 1, file) != 1 ||
+        replay->header.magic != REPLAY_MAGIC || replay->header.version != REPLAY_VERSION) {
+        TraceLog(LOG_WARNING, "REPLAY: %s is not a replay (or from another version)", path);
+        fclose(file);
+        return false;
+    }
+    // Inputs are per tick, so at another rate they'd land at different times and the checksums never match
+    if (replay->header.tickRate != tickRate) {
+        TraceLog(LOG_WARNING, "REPLAY: %s was recorded at %u ticks per second, this build runs %u",
+                 path, replay->header.tickRate, tickRate);
+        fclose(file);
+        return false;
+    }
+
+    // The rest is tick records - a torn last record (crash while recording) is dropped
+    long start = ftell(file);
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file) - start;
+    fseek(file, start, SEEK_SET);
+    replay->tickCount = size / REPLAY_TICK_SIZE;
+    replay->ticks = malloc(replay->tickCount ? replay->tickCount * REPLAY_TICK_SIZE : 1);
+    if (!replay->ticks || fread(replay->ticks, REPLAY_TICK_SIZE, replay->tickCount, file) != (size_t)replay->tickCount) {
+        fclose(file);
+        CloseReplay(replay);
+        return false;
+    }
+    fclose(file);
+    return true;
+}
+
+bool ReadReplayTick(Replay *replay, CharacterInput *input) {
+    if (replay->position >= replay->tickCount) return false;
+    *input = unpack_input(replay->ticks[replay->position * REPLAY_TICK_SIZE]);
+    replay->position++;
+    return true;
+}
+
+void CheckReplayTick(Replay *replay, uint32_t checksum) {
+    long tick = replay->position - 1;
+    if (tick < 0 || tick >= replay->tickCount || replay->divergedAt >= 0) return;  // Only the first divergence matters
+
+    uint32_t expected;
+    memcpy(&expected, replay->ticks + tick * REPLAY_TICK_SIZE + 1, sizeof(expected));
+    if (checksum != expected) {
+        replay->divergedAt = tick;
+        TraceLog(LOG_WARNING, "REPLAY: Diverged at tick %ld (checksum %08x, recorded %08x)", tick, checksum, expected);
+    }
+}
+
+bool IsReplayFinished(const Replay *replay) {
+    return !replay->recording && replay->position >= replay->tickCount;
+}
+
+void CloseReplay(Replay *replay) {
+    if (replay->file) fclose(replay->file);
+    free(replay->ticks);
+    replay->file = NULL;
+    replay->ticks = NULL;
+}
@@ -0,0 +1,63 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+// Include necessary libraries
+#include <stdio.h>
+#include <stdint.h>
+#include "character.h"  // CharacterInput stored per tick
+#include "level.h"      // LEVEL_PATH_LENGTH
+
+/*
+    Input recording / replay (ManaRush <map> --record run.mrrp, --replay run.mrrp)
+    The simulation is deterministic given its seed and the controls of every tick, so that is all
+    a recording holds:
+        ReplayHeader
+        tick records            one per simulated tick, appended while recording
+    Each tick also stores a checksum of the game state after it. Playback compares them and
+    reports the first tick that came out different (a determinism bug, or a build that changed
+    gameplay). Ticks are streamed to the file as they happen, so a crash only loses what stdio
+    still had buffered.
+*/
+#define REPLAY_MAGIC 0x5052524Du     // "MRRP" read as little-endian bytes
+#define REPLAY_VERSION 1
+
+// Control bits of a tick
+#define REPLAY_INPUT_LEFT  0x01
+#define REPLAY_INPUT_RIGHT 0x02
+#define REPLAY_INPUT_JUMP  0x04
+#define REPLAY_INPUT_SHOOT 0x08
+
+typedef struct ReplayHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t seed;                   // Game RNG seed the run started with
+    uint32_t tickRate;               // SIM_TICK_RATE of the recording build
+    char level[LEVEL_PATH_LENGTH];   // Map the run was played on (informational)
+} ReplayHeader;
+
+// One tick on disk: input bits (1 byte) + checksum after the tick (uint32)
+#define REPLAY_TICK_SIZE 5
+
+typedef struct Replay {
+    ReplayHeader header;
+    bool recording;                  // true: ticks are appended to file, false: played back from ticks
+    FILE *file;                      // Recording output
+    uint8_t *ticks;                  // Playback: every tick record as read from disk
+    long tickCount;
+    long position;                   // Playback: next tick to read
+    long divergedAt;                 // First tick whose checksum didn't match (-1 = none so far)
+} Replay;
+
+// Function declarations - recording
+bool StartReplayRecording(Replay *replay, const char *path, const char *levelPath, uint32_t seed, uint32_t tickRate);
+void RecordReplayTick(Replay *replay, CharacterInput input, uint32_t checksum);
+
+// Function declarations - playback
+bool LoadReplay(Replay *replay, const char *path, uint32_t tickRate); // Whole file into memory (false if recorded at another tick rate)
+bool ReadReplayTick(Replay *replay, CharacterInput *input);     // Controls of the next tick (false past the end)
+void CheckReplayTick(Replay *replay, uint32_t checksum);        // Compare the state after the tick just read
+bool IsReplayFinished(const Replay *replay);
+
+void CloseReplay(Replay *replay);                               // Flush / free either kind
+
+#endif
@@ -0,0 +1,19 @@
+#include "rng.h"
+
+void SeedRng(Rng *rng, uint32_t seed) {
+    rng->state = seed ? seed : 1;  // xorshift sticks at 0
+}
+
+uint32_t NextRng(Rng *rng) {
+    uint32_t x = rng->state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rng->state = x;
+    return x;
+}
+
+int RngRange(Rng *rng, int count) {
+    if (count <= 0) return 0;
+    return (int)(NextRng(rng) % (uint32_t)count);
+}
@@ -0,0 +1,17 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+// Seeded random numbers (xorshift32) - the same seed gives the same sequence on every platform,
+// unlike rand(), so runs can be replayed. Each game owns its own generator
+typedef struct Rng {
+    uint32_t state;      // Never 0
+} Rng;
+
+// Function declarations - random numbers
+void SeedRng(Rng *rng, uint32_t seed);
+uint32_t NextRng(Rng *rng);            // Next raw value
+int RngRange(Rng *rng, int count);     // 0 .. count-1 (0 if count <= 0)
+
+#endif
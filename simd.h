@@ -0,0 +1,80 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+/*
+    4-wide float vectors for the batch kernels (projectiles, particles)
+        -SSE2 on x86-64 (always there, so no runtime dispatch or extra compile flags)
+        -NEON on arm64 (Apple Silicon)
+        -plain structs everywhere else, or with SIMD_FORCE_SCALAR defined
+    Kernels are written once against these and run 4 lanes per step. Data they walk must be
+    padded to a multiple of SIMD_WIDTH; loads and stores are unaligned, so heap arrays are fine.
+    Masks are all-ones / all-zero lanes, like the compare instructions produce.
+*/
+#define SIMD_WIDTH 4
+
+#if !defined(SIMD_FORCE_SCALAR) && (defined(__SSE2__) || defined(_M_X64))
+#define SIMD_SSE2 1
+#include <emmintrin.h>
+
+typedef __m128 F4;
+typedef __m128 M4;
+
+static inline F4 F4Load(const float *p) { return _mm_loadu_ps(p); }
+static inline void F4Store(float *p, F4 v) { _mm_storeu_ps(p, v); }
+static inline F4 F4Set(float x) { return _mm_set1_ps(x); }
+static inline F4 F4Add(F4 a, F4 b) { return _mm_add_ps(a, b); }
+static inline F4 F4Sub(F4 a, F4 b) { return _mm_sub_ps(a, b); }
+static inline F4 F4Mul(F4 a, F4 b) { return _mm_mul_ps(a, b); }
+static inline F4 F4Abs(F4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+static inline M4 M4Less(F4 a, F4 b) { return _mm_cmplt_ps(a, b); }
+static inline M4 M4Greater(F4 a, F4 b) { return _mm_cmpgt_ps(a, b); }
+static inline M4 M4Or(M4 a, M4 b) { return _mm_or_ps(a, b); }
+static inline M4 M4And(M4 a, M4 b) { return _mm_and_ps(a, b); }
+static inline int M4Bits(M4 m) { return _mm_movemask_ps(m); }   // Lane i -> bit i
+
+#elif !defined(SIMD_FORCE_SCALAR) && ((defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64))
+#define SIMD_NEON 1
+#include <arm_neon.h>
+
+typedef float32x4_t F4;
+typedef uint32x4_t M4;
+
+static inline F4 F4Load(const float *p) { return vld1q_f32(p); }
+static inline void F4Store(float *p, F4 v) { vst1q_f32(p, v); }
+static inline F4 F4Set(float x) { return vdupq_n_f32(x); }
+static inline F4 F4Add(F4 a, F4 b) { return vaddq_f32(a, b); }
+static inline F4 F4Sub(F4 a, F4 b) { return vsubq_f32(a, b); }
+static inline F4 F4Mul(F4 a, F4 b) { return vmulq_f32(a, b); }
+static inline F4 F4Abs(F4 a) { return vabsq_f32(a); }
+static inline M4 M4Less(F4 a, F4 b) { return vcltq_f32(a, b); }
+static inline M4 M4Greater(F4 a, F4 b) { return vcgtq_f32(a, b); }
+static inline M4 M4Or(M4 a, M4 b) { return vorrq_u32(a, b); }
+static inline M4 M4And(M4 a, M4 b) { return vandq_u32(a, b); }
+static inline int M4Bits(M4 m) {
+    static const int32_t shifts[4] = { 0, 1, 2, 3 };
+    uint32x4_t bits = vshlq_u32(vshrq_n_u32(m, 31), vld1q_s32(shifts));
+    return (int)vaddvq_u32(bits);
+}
+
+#else
+#define SIMD_SCALAR 1
+
+typedef struct F4 { float v[4]; } F4;
+typedef struct M4 { int v[4]; } M4;
+
+static inline F4 F4Load(const float *p) { return (F4){{ p[0], p[1], p[2], p[3] }}; }
+static inline void F4Store(float *p, F4 a) { for (int i = 0; i < 4; i++) p[i] = a.v[i]; }
+static inline F4 F4Set(float x) { return (F4){{ x, x, x, x }}; }
+static inline F4 F4Add(F4 a, F4 b) { for (int i = 0; i < 4; i++) a.v[i] += b.v[i]; return a; }
+static inline F4 F4Sub(F4 a, F4 b) { for (int i = 0; i < 4; i++) a.v[i] -= b.v[i]; return a; }
+static inline F4 F4Mul(F4 a, F4 b) { for (int i = 0; i < 4; i++) a.v[i] *= b.v[i]; return a; }
+static inline F4 F4Abs(F4 a) { for (int i = 0; i < 4; i++) a.v[i] = a.v[i] < 0 ? -a.v[i] : a.v[i]; return a; }
+static inline M4 M4Less(F4 a, F4 b) { M4 m; for (int i = 0; i < 4; i++) m.v[i] = a.v[i] < b.v[i]; return m; }
+static inline M4 M4Greater(F4 a, F4 b) { M4 m; for (int i = 0; i < 4; i++) m.v[i] = a.v[i] > b.v[i]; return m; }
+static inline M4 M4Or(M4 a, M4 b) { for (int i = 0; i < 4; i++) a.v[i] = a.v[i] || b.v[i]; return a; }
+static inline M4 M4And(M4 a, M4 b) { for (int i = 0; i < 4; i++) a.v[i] = a.v[i] && b.v[i]; return a; }
+static inline int M4Bits(M4 m) { return (m.v[0] ? 1 : 0) | (m.v[1] ? 2 : 0) | (m.v[2] ? 4 : 0) | (m.v[3] ? 8 : 0); }
+
+#endif
+
+#endif
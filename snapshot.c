@@ -0,0 +1,74 @@
+#include "snapshot.h"
+#include "raylib.h"  // TraceLog
+#include <stdlib.h>
+#include <string.h>
+
+void BeginSnapshot(Snapshot *snapshot) {
+    snapshot->size = 0;
+    snapshot->failed = false;
+}
+
+void WriteSnapshot(Snapshot *snapshot, const void *data, size_t size) {
+    if (snapshot->failed || size == 0) return;
+    if (snapshot->size + size > snapshot->capacity) {
+        size_t capacity = snapshot->capacity ? snapshot->capacity : 4096;
+        while (capacity < snapshot->size + size) capacity *= 2;
+        unsigned char *grown = realloc(snapshot->data, capacity);
+        if (!grown) {
+            TraceLog(LOG_WARNING, "SNAPSHOT: Out of memory growing to %zu bytes", capacity);
+            snapshot->failed = true;
+            return;
+        }
+        snapshot->data = grown;
+        snapshot->capacity = capacity;
+    }
+    memcpy(snapshot->data + snapshot->size, data, size);
+    snapshot->size += size;
+}
+
+SnapshotReader ReadSnapshot(const Snapshot *snapshot) {
+    return (SnapshotReader){ snapshot->data, snapshot->size, 0, snapshot->failed };
+}
+
+bool ReadSnapshotBytes(SnapshotReader *reader, void *data, size_t size) {
+    if (reader->failed || size > reader->size - reader->position) {
+        reader->failed = true;
+        return false;
+    }
+    if (size > 0) memcpy(data, reader->data + reader->position, size);
+    reader->position += size;
+    return true;
+}
+
+void FreeSnapshot(Snapshot *snapshot) {
+    free(snapshot->data);
+    memset(snapshot, 0, sizeof(*snapshot));
+}
+
+Snapshot *PushSnapshot(SnapshotRing *ring) {
+    ring->newest = (ring->newest + 1) % SNAPSHOT_HISTORY;
+    if (ring->count < SNAPSHOT_HISTORY) ring->count++;
+    return &ring->snapshots[ring->newest];
+}
+
+const Snapshot *GetSnapshot(const SnapshotRing *ring, int ticksBack) {
+    if (ticksBack < 0 || ticksBack >= ring->count) return NULL;
+    return &ring->snapshots[(ring->newest - ticksBack + SNAPSHOT_HISTORY) % SNAPSHOT_HISTORY];
+}
+
+void DropSnapshots(SnapshotRing *ring, int count) {
+    if (count > ring->count) count = ring->count;
+    if (count <= 0) return;
+    ring->newest = (ring->newest - count + SNAPSHOT_HISTORY) % SNAPSHOT_HISTORY;
+    ring->count -= count;
+}
+
+void ClearSnapshots(SnapshotRing *ring) {
+    ring->count = 0;
+}
+
+void FreeSnapshots(SnapshotRing *ring) {
+    for (int i = 0; i < SNAPSHOT_HISTORY; i++) FreeSnapshot(&ring->snapshots[i]);
+    ring->newest = 0;
+    ring->count = 0;
+}
@@ -0,0 +1,59 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Snapshot constants
+#define SNAPSHOT_HISTORY 256      // Ticks a history ring keeps (a bit over 2 s at SIM_TICK_RATE)
+
+/*
+    Snapshot - the simulation state of one tick as a flat byte buffer
+    Everything that changes from tick to tick is plain data (handles instead of pointers), so
+    saving is a straight run of memcpys: the fixed-size part of the state in one go, then each
+    live array (entity tables, component sets, projectile fields) up to its count. Restoring
+    copies the same bytes back in the same order. Loaded resources (level, atlas, textures,
+    render caches) are never written - they don't change while a game runs.
+    The buffer is kept between saves, so once it has grown to the state's size saving allocates
+    nothing.
+*/
+typedef struct Snapshot {
+    unsigned char *data;
+    size_t size;              // Bytes written
+    size_t capacity;
+    bool failed;              // Ran out of memory while writing (can't be restored)
+    long tick;                // Tick the state is from (after it ran)
+    uint32_t hash;            // Checksum of the state (what a replay would record for the tick) - checked on restore
+} Snapshot;
+
+// Restores read the buffer front to back
+typedef struct SnapshotReader {
+    const unsigned char *data;
+    size_t size;
+    size_t position;
+    bool failed;              // Read past the end (snapshot from a different layout)
+} SnapshotReader;
+
+// The last SNAPSHOT_HISTORY ticks - saving over the oldest once full
+typedef struct SnapshotRing {
+    Snapshot snapshots[SNAPSHOT_HISTORY];
+    int newest;               // Slot of the latest save
+    int count;                // Saves held
+} SnapshotRing;
+
+// Function declarations - writing and reading
+void BeginSnapshot(Snapshot *snapshot);                                  // Start over (keeps the buffer)
+void WriteSnapshot(Snapshot *snapshot, const void *data, size_t size);   // Append bytes
+SnapshotReader ReadSnapshot(const Snapshot *snapshot);                   // Reader at the start
+bool ReadSnapshotBytes(SnapshotReader *reader, void *data, size_t size); // Next bytes (false past the end)
+void FreeSnapshot(Snapshot *snapshot);
+
+// Function declarations - history
+Snapshot *PushSnapshot(SnapshotRing *ring);                              // Slot for a new save (the oldest once full)
+const Snapshot *GetSnapshot(const SnapshotRing *ring, int ticksBack);    // 0 = newest (NULL if not held)
+void DropSnapshots(SnapshotRing *ring, int count);                       // Forget the newest count saves (after a rewind)
+void ClearSnapshots(SnapshotRing *ring);                                 // Forget every save (buffers are kept)
+void FreeSnapshots(SnapshotRing *ring);
+
+#endif
@@ -0,0 +1,215 @@
+#include "thread.h"
+#include <stdlib.h>
+
+// Entry point plus argument, handed to the new thread
+typedef struct ThreadStart {
+    void (*entry)(void *arg);
+    void *arg;
+} ThreadStart;
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+static DWORD WINAPI thread_main(LPVOID param) {
+    ThreadStart start = *(ThreadStart *)param;
+    free(param);
+    start.entry(start.arg);
+    return 0;
+}
+
+bool StartThread(Thread *thread, void (*entry)(void *arg), void *arg) {
+    thread->handle = NULL;
+    ThreadStart *start = malloc(sizeof(ThreadStart));
+    if (!start) return false;
+    *start = (ThreadStart){ entry, arg };
+    thread->handle = CreateThread(NULL, 0, thread_main, start, 0, NULL);
+    if (!thread->handle) free(start);
+    return thread->handle != NULL;
+}
+
+void JoinThread(Thread *thread) {
+    if (!thread->handle) return;
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+    thread->handle = NULL;
+}
+
+int AtomicLoad(AtomicInt *atomic) {
+    return (int)InterlockedCompareExchange(&atomic->value, 0, 0);
+}
+
+void AtomicStore(AtomicInt *atomic, int value) {
+    InterlockedExchange(&atomic->value, value);
+}
+
+int AtomicAdd(AtomicInt *atomic, int amount) {
+    return (int)InterlockedExchangeAdd(&atomic->value, amount) + amount;
+}
+
+bool AtomicCompareExchange(AtomicInt *atomic, int expected, int desired) {
+    return InterlockedCompareExchange(&atomic->value, desired, expected) == expected;
+}
+
+void YieldThread(void) {
+    SwitchToThread();
+}
+
+int GetCpuCount(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+}
+
+// Slim reader/writer lock plus condition variable
+typedef struct WaitPointData {
+    SRWLOCK lock;
+    CONDITION_VARIABLE condition;
+} WaitPointData;
+
+bool InitWaitPoint(WaitPoint *point) {
+    WaitPointData *data = malloc(sizeof(WaitPointData));
+    if (data) {
+        InitializeSRWLock(&data->lock);
+        InitializeConditionVariable(&data->condition);
+    }
+    point->handle = data;
+    return data != NULL;
+}
+
+void FreeWaitPoint(WaitPoint *point) {
+    free(point->handle);
+    point->handle = NULL;
+}
+
+void WaitForChange(WaitPoint *point, AtomicInt *value, int seen) {
+    WaitPointData *data = point->handle;
+    AcquireSRWLockExclusive(&data->lock);
+    while (AtomicLoad(value) == seen) {
+        SleepConditionVariableSRW(&data->condition, &data->lock, INFINITE, 0);
+    }
+    ReleaseSRWLockExclusive(&data->lock);
+}
+
+void WakeWaiters(WaitPoint *point) {
+    WaitPointData *data = point->handle;
+    // Taking the lock orders this after a waiter's check, so its wait can't miss the change
+    AcquireSRWLockExclusive(&data->lock);
+    WakeAllConditionVariable(&data->condition);
+    ReleaseSRWLockExclusive(&data->lock);
+}
+
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+static void *thread_main(void *param) {
+    ThreadStart start = *(ThreadStart *)param;
+    free(param);
+    start.entry(start.arg);
+    return NULL;
+}
+
+bool StartThread(Thread *thread, void (*entry)(void *arg), void *arg) {
+    thread->handle = NULL;
+    ThreadStart *start = malloc(sizeof(ThreadStart));
+    pthread_t *handle = malloc(sizeof(pthread_t));
+    if (!start || !handle) {
+        free(start);
+        free(handle);
+        return false;
+    }
+    *start = (ThreadStart){ entry, arg };
+    if (pthread_create(handle, NULL, thread_main, start) != 0) {
+        free(start);
+        free(handle);
+        thread->handle = NULL;
+        return false;
+    }
+    thread->handle = handle;
+    return true;
+}
+
+void JoinThread(Thread *thread) {
+    if (!thread->handle) return;
+    pthread_join(*(pthread_t *)thread->handle, NULL);
+    free(thread->handle);
+    thread->handle = NULL;
+}
+
+int AtomicLoad(AtomicInt *atomic) {
+    return (int)__atomic_load_n(&atomic->value, __ATOMIC_ACQUIRE);
+}
+
+void AtomicStore(AtomicInt *atomic, int value) {
+    __atomic_store_n(&atomic->value, value, __ATOMIC_RELEASE);
+}
+
+int AtomicAdd(AtomicInt *atomic, int amount) {
+    return (int)__atomic_add_fetch(&atomic->value, amount, __ATOMIC_ACQ_REL);
+}
+
+bool AtomicCompareExchange(AtomicInt *atomic, int expected, int desired) {
+    long want = expected;
+    return __atomic_compare_exchange_n(&atomic->value, &want, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+void YieldThread(void) {
+    sched_yield();
+}
+
+int GetCpuCount(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+}
+
+// Mutex plus condition variable
+typedef struct WaitPointData {
+    pthread_mutex_t mutex;
+    pthread_cond_t condition;
+} WaitPointData;
+
+bool InitWaitPoint(WaitPoint *point) {
+    point->handle = NULL;
+    WaitPointData *data = malloc(sizeof(WaitPointData));
+    if (!data) return false;
+    if (pthread_mutex_init(&data->mutex, NULL) != 0) {
+        free(data);
+        return false;
+    }
+    if (pthread_cond_init(&data->condition, NULL) != 0) {
+        pthread_mutex_destroy(&data->mutex);
+        free(data);
+        return false;
+    }
+    point->handle = data;
+    return true;
+}
+
+void FreeWaitPoint(WaitPoint *point) {
+    WaitPointData *data = point->handle;
+    if (!data) return;
+    pthread_mutex_destroy(&data->mutex);
+    pthread_cond_destroy(&data->condition);
+    free(data);
+    point->handle = NULL;
+}
+
+void WaitForChange(WaitPoint *point, AtomicInt *value, int seen) {
+    WaitPointData *data = point->handle;
+    pthread_mutex_lock(&data->mutex);
+    while (AtomicLoad(value) == seen) {
+        pthread_cond_wait(&data->condition, &data->mutex);
+    }
+    pthread_mutex_unlock(&data->mutex);
+}
+
+void WakeWaiters(WaitPoint *point) {
+    WaitPointData *data = point->handle;
+    // Taking the lock orders this after a waiter's check, so its wait can't miss the change
+    pthread_mutex_lock(&data->mutex);
+    pthread_cond_broadcast(&data->condition);
+    pthread_mutex_unlock(&data->mutex);
+}
+#endif
@@ -0,0 +1,45 @@
+#ifndef THREAD_H
+#define THREAD_H
+
+// Kept free of raylib.h so the platform headers (windows.h) don't clash with raylib names
+#include <stdbool.h>
+
+// Worker thread (pthreads, or Win32 threads on Windows)
+typedef struct Thread {
+    void *handle;       // Platform thread handle (NULL when not running)
+} Thread;
+
+// Int shared between threads - loads acquire, stores release
+typedef struct AtomicInt {
+    volatile long value;
+} AtomicInt;
+
+// Lock plus condition variable - lets idle threads sleep until someone has work for them
+typedef struct WaitPoint {
+    void *handle;       // Platform lock + condition (NULL when not initialised)
+} WaitPoint;
+
+// Thread-local storage class (MSVC's C mode has no _Thread_local)
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL _Thread_local
+#endif
+
+// Function declarations - threads
+bool StartThread(Thread *thread, void (*entry)(void *arg), void *arg);  // Run entry(arg) on a new thread (false if it can't be started)
+void JoinThread(Thread *thread);                                         // Wait for the thread to finish (no-op if not started)
+void YieldThread(void);                                                  // Give the rest of this time slice away
+int GetCpuCount(void);                                                   // Logical processors (at least 1)
+
+bool InitWaitPoint(WaitPoint *point);                                    // False if it can't be set up (nothing to free)
+void FreeWaitPoint(WaitPoint *point);
+void WaitForChange(WaitPoint *point, AtomicInt *value, int seen);        // Sleep while value still holds seen
+void WakeWaiters(WaitPoint *point);                                      // Wake every sleeper (change value first)
+
+int AtomicLoad(AtomicInt *atomic);
+void AtomicStore(AtomicInt *atomic, int value);
+int AtomicAdd(AtomicInt *atomic, int amount);                            // Returns the new value
+bool AtomicCompareExchange(AtomicInt *atomic, int expected, int desired); // Set to desired if it still holds expected
+
+#endif
@@ -0,0 +1,106 @@
+#include "tile_batch.h"
+#include "tmx.h"
+#include "rlgl.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Quads submitted per rlBegin/rlEnd block (keeps each block inside raylib's internal batch)
+#define TILE_BATCH_BLOCK 1024
+
+// Find the stream for a texture, creating it on first use
+static TileBatch *GetBatch(TileBatcher *batcher, Texture2D texture) {
+    for (int i = 0; i < batcher->batchCount; i++) {
+        if (batcher->batches[i].texture.id == texture.id) return &batcher->batches[i];
+    }
+    if (batcher->batchCount == batcher->batchCapacity) {
+        batcher->batchCapacity = batcher->batchCapacity ? batcher->batchCapacity * 2 : 4;
+        batcher->batches = realloc(batcher->batches, batcher->batchCapacity * sizeof(TileBatch));
+    }
+    TileBatch *batch = &batcher->batches[batcher->batchCount++];
+    memset(batch, 0, sizeof(*batch));
+    batch->texture = texture;
+    return batch;
+}
+
+/*
+    Queue one tile quad.
+    TMX flip bits are applied to the texture coordinates the way Tiled renders them:
+    diagonal flip (swap axes) first, then horizontal, then vertical.
+    Each display corner looks up its source corner through the inverse of that transform.
+*/
+void PushTile(TileBatcher *batcher, Texture2D texture, Rectangle src, Vector2 dst, unsigned int flags, Color tint) {
+    TileBatch *batch = GetBatch(batcher, texture);
+    if (batch->quadCount == batch->quadCapacity) {
+        batch->quadCapacity = batch->quadCapacity ? batch->quadCapacity * 2 : 256;
+        batch->vertices = realloc(batch->vertices, batch->quadCapacity * 4 * sizeof(TileVertex));
+        batch->colors = realloc(batch->colors, batch->quadCapacity * sizeof(Color));
+    }
+
+    // Texture coordinates of the source rectangle
+    float u0 = src.x / texture.width;
+    float v0 = src.y / texture.height;
+    float u1 = (src.x + src.width) / texture.width;
+    float v1 = (src.y + src.height) / texture.height;
+
+    // Display corners in quad order: top-left, bottom-left, bottom-right, top-right
+    static const int corners[4][2] = { {0, 0}, {0, 1}, {1, 1}, {1, 0} };
+    TileVertex *v = &batch->vertices[batch->quadCount * 4];
+    for (int i = 0; i < 4; i++) {
+        int cx = corners[i][0];
+        int cy = corners[i][1];
+
+        // Source corner for this display corner
+        int sx = cx, sy = cy;
+        if (flags & TMX_FLIPPED_VERTICALLY) sy = 1 - sy;
+        if (flags & TMX_FLIPPED_HORIZONTALLY) sx = 1 - sx;
+        if (flags & TMX_FLIPPED_DIAGONALLY) { int t = sx; sx = sy; sy = t; }
+
+        v[i].x = dst.x + cx * src.width;
+        v[i].y = dst.y + cy * src.height;
+        v[i].u = sx ? u1 : u0;
+        v[i].v = sy ? v1 : v0;
+    }
+    batch->colors[batch->quadCount] = tint;
+    batch->quadCount++;
+}
+
+// Submit all queued quads - one texture bind per tileset
+void FlushTileBatches(TileBatcher *batcher) {
+    for (int b = 0; b < batcher->batchCount; b++) {
+        TileBatch *batch = &batcher->batches[b];
+        if (batch->quadCount == 0) continue;
+
+        for (int start = 0; start < batch->quadCount; start += TILE_BATCH_BLOCK) {
+            int count = batch->quadCount - start;
+            if (count > TILE_BATCH_BLOCK) count = TILE_BATCH_BLOCK;
+
+            // Flush raylib's internal batch first if this block would not fit
+            rlCheckRenderBatchLimit(count * 4);
+            rlSetTexture(batch->texture.id);
+            rlBegin(RL_QUADS);
+            for (int q = start; q < start + count; q++) {
+                Color c = batch->colors[q];
+                TileVertex *v = &batch->vertices[q * 4];
+                rlColor4ub(c.r, c.g, c.b, c.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);
+                for (int i = 0; i < 4; i++) {
+                    rlTexCoord2f(v[i].u, v[i].v);
+                    rlVertex2f(v[i].x, v[i].y);
+                }
+            }
+            rlEnd();
+        }
+        rlSetTexture(0);
+        batch->quadCount = 0;
+    }
+}
+
+// Release all stream storage
+void FreeTileBatcher(TileBatcher *batcher) {
+    for (int i = 0; i < batcher->batchCount; i++) {
+        free(batcher->batches[i].vertices);
+        free(batcher->batches[i].colors);
+    }
+    free(batcher->batches);
+    memset(batcher, 0, sizeof(*batcher));
+}
@@ -0,0 +1,34 @@
+#ifndef TILE_BATCH_H
+#define TILE_BATCH_H
+
+// Include necessary libraries
+#include "raylib.h"  // Texture2D, Rectangle, Color types
+
+// One vertex of a tile quad (world position + normalized texture coordinate)
+typedef struct TileVertex {
+    float x, y;      // Position
+    float u, v;      // Texture coordinate
+} TileVertex;
+
+// Vertex stream for one tileset texture
+typedef struct TileBatch {
+    Texture2D texture;          // Tileset texture all quads sample from
+    TileVertex *vertices;       // 4 vertices per quad (top-left, bottom-left, bottom-right, top-right)
+    Color *colors;              // Tint per quad
+    int quadCount;              // Quads queued since the last flush
+    int quadCapacity;           // Allocated quads
+} TileBatch;
+
+// Tile batcher - groups queued tiles by texture so each tileset is submitted once
+typedef struct TileBatcher {
+    TileBatch *batches;         // One stream per tileset texture seen so far
+    int batchCount;
+    int batchCapacity;
+} TileBatcher;
+
+// Function declarations - tile batching
+void PushTile(TileBatcher *batcher, Texture2D texture, Rectangle src, Vector2 dst, unsigned int flags, Color tint); // Queue one tile (flags = TMX flip bits)
+void FlushTileBatches(TileBatcher *batcher);   // Submit every stream (one texture bind each) and reset them
+void FreeTileBatcher(TileBatcher *batcher);    // Release all stream storage
+
+#endif
@@ -0,0 +1,120 @@
+#include "ui.h"
+#include <string.h>
+
+// Build the glyph quads for text->text (same placement rules raylib's DrawTextEx uses)
+static void layout_text(UiText *text) {
+    Font font = text->font;
+    float scale = text->fontSize / font.baseSize;
+    float x = 0;
+    text->quadCount = 0;
+
+    for (int i = 0; text->text[i] != '\0';) {
+        int codepointSize = 0;
+        int codepoint = GetCodepointNext(&text->text[i], &codepointSize);
+        int index = GetGlyphIndex(font, codepoint);
+        i += codepointSize;
+
+        // Whitespace only advances the pen
+        if (codepoint != ' ' && codepoint != '\t' && text->quadCount < UI_TEXT_LENGTH) {
+            float pad = (float)font.glyphPadding;
+            Rectangle source = {
+                font.recs[index].x - pad,
+                font.recs[index].y - pad,
+                font.recs[index].width + 2 * pad,
+                font.recs[index].height + 2 * pad
+            };
+            text->quads[text->quadCount++] = (UiGlyphQuad){
+                source,
+                (Rectangle){
+                    x + (font.glyphs[index].offsetX - pad) * scale,
+                    (font.glyphs[index].offsetY - pad) * scale,
+                    source.width * scale,
+                    source.height * scale
+                }
+            };
+        }
+
+        if (font.glyphs[index].advanceX == 0) x += font.recs[index].width * scale + text->spacing;
+        else x += font.glyphs[index].advanceX * scale + text->spacing;
+    }
+
+    text->size = MeasureTextEx(font, text->text, text->fontSize, text->spacing);
+}
+
+void SetUiText(UiText *text, Font font, float fontSize, float spacing, const char *string) {
+    // Nothing changed - keep the cached layout
+    if (text->font.texture.id == font.texture.id && text->fontSize == fontSize &&
+        text->spacing == spacing && strncmp(text->text, string, UI_TEXT_LENGTH - 1) == 0) {
+        return;
+    }
+
+    text->font = font;
+    text->fontSize = fontSize;
+    text->spacing = spacing;
+    strncpy(text->text, string, UI_TEXT_LENGTH - 1);
+    text->text[UI_TEXT_LENGTH - 1] = '\0';
+    layout_text(text);
+}
+
+void DrawUiText(const UiText *text, Vector2 position, Color tint) {
+    for (int i = 0; i < text->quadCount; i++) {
+        Rectangle dest = text->quads[i].dest;
+        dest.x += position.x;
+        dest.y += position.y;
+        DrawTexturePro(text->font.texture, text->quads[i].source, dest, (Vector2){0, 0}, 0.0f, tint);
+    }
+}
+
+void BeginUiPanel(UiPanel *panel, float x, float y, float width, float height) {
+    // Grow the texture only when the new size doesn't fit
+    if (panel->target.id == 0 || width > panel->target.texture.width || height > panel->target.texture.height) {
+        if (panel->target.id != 0) UnloadRenderTexture(panel->target);
+        panel->target = LoadRenderTexture((int)width + 1, (int)height + 1);
+    }
+    panel->bounds = (Rectangle){x, y, width, height};
+
+    BeginTextureMode(panel->target);
+    ClearBackground(BLANK);
+}
+
+void EndUiPanel(UiPanel *panel) {
+    EndTextureMode();
+    panel->dirty = false;
+}
+
+void DrawUiPanel(const UiPanel *panel) {
+    if (panel->target.id == 0) return;
+
+    // Only the used part of the texture. Render textures are stored upside down, so the height is negative
+    Rectangle source = {
+        0,
+        panel->target.texture.height - panel->bounds.height,
+        panel->bounds.width,
+        -panel->bounds.height
+    };
+    DrawTextureRec(panel->target.texture, source, (Vector2){panel->bounds.x, panel->bounds.y}, WHITE);
+}
+
+void UnloadUiPanel(UiPanel *panel) {
+    if (panel->target.id != 0) UnloadRenderTexture(panel->target);
+    panel->target = (RenderTexture2D){0};
+    panel->dirty = true;
+}
+
+bool UpdateUiButton(UiButton *button, Vector2 mouse) {
+    bool hovered = CheckCollisionPointRec(mouse, button->bounds);
+    if (hovered == button->hovered) return false;
+    button->hovered = hovered;
+    return true;
+}
+
+void DrawUiButton(const UiButton *button) {
+    DrawRectangleRec(button->bounds, button->hovered ? button->hoverColor : button->color);
+    DrawRectangleLinesEx(button->bounds, 2, BLACK);
+
+    Vector2 labelPos = {
+        button->bounds.x + (button->bounds.width - button->label.size.x) / 2,
+        button->bounds.y + button->labelOffsetY
+    };
+    DrawUiText(&button->label, labelPos, WHITE);
+}
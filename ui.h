@@ -0,0 +1,72 @@
+#ifndef UI_H
+#define UI_H
+
+// Include necessary libraries
+#include "raylib.h"  // Font, RenderTexture2D and drawing
+
+// UI constants
+#define UI_TEXT_LENGTH 64    // Maximum characters in one text widget
+
+// One laid-out glyph: where it sits in the font atlas and where it goes on screen (relative to the text origin)
+typedef struct UiGlyphQuad {
+    Rectangle source;
+    Rectangle dest;
+} UiGlyphQuad;
+
+// Text widget - the string is laid out into glyph quads once and only again when it changes
+typedef struct UiText {
+    Font font;                          // Font the quads point into
+    float fontSize;
+    float spacing;
+    char text[UI_TEXT_LENGTH];          // String the quads were built from
+    UiGlyphQuad quads[UI_TEXT_LENGTH];  // Cached layout (spaces have no quad)
+    int quadCount;
+    Vector2 size;                       // Measured size of the whole string
+} UiText;
+
+// Static panel - everything in it is rendered once into a texture and redrawn as a single quad
+typedef struct UiPanel {
+    Rectangle bounds;          // Screen position and size of the panel
+    RenderTexture2D target;    // Cached render (may be larger than bounds after a resize)
+    bool dirty;                // Needs to be rebuilt before the next draw
+} UiPanel;
+
+// Button - label layout is cached, hover state is tracked so panels only rebuild when it flips
+typedef struct UiButton {
+    Rectangle bounds;
+    UiText label;
+    float labelOffsetY;        // Label distance from the top of the button
+    Color color;
+    Color hoverColor;
+    bool hovered;
+} UiButton;
+
+// Function declarations - retained UI
+
+// Sets the text of a widget. Layout only runs when font, size or string differ from the cached ones
+void SetUiText(UiText *text, Font font, float fontSize, float spacing, const char *string);
+
+// Draws the cached glyph quads at position
+void DrawUiText(const UiText *text, Vector2 position, Color tint);
+
+/*
+    Starts rendering into a panel of the given size at (x, y).
+    The texture is only reallocated when the panel grows.
+    Has to be called outside BeginMode2D. Pair with EndUiPanel
+*/
+void BeginUiPanel(UiPanel *panel, float x, float y, float width, float height);
+void EndUiPanel(UiPanel *panel);
+
+// Draws the cached panel texture
+void DrawUiPanel(const UiPanel *panel);
+
+// Frees the panel texture
+void UnloadUiPanel(UiPanel *panel);
+
+// Updates hover state from the mouse. Returns true when it changed (owning panel needs a rebuild)
+bool UpdateUiButton(UiButton *button, Vector2 mouse);
+
+// Draws the button in its current hover state (panel-local coordinates)
+void DrawUiButton(const UiButton *button);
+
+#endif
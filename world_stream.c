@@ -0,0 +1,54 @@
+#include "world_stream.h"
+#include "map_renderer.h"
+#include <math.h>
+
+// Spans around what the camera sees - the load span leans towards the direction of travel
+StreamWindow GetStreamWindow(const Level *level, Camera2D camera, int direction) {
+    float tileW = level->header->tileWidth;
+    StreamWindow window;
+    window.view0 = GetScreenToWorld2D((Vector2){0, 0}, camera).x;
+    window.view1 = GetScreenToWorld2D((Vector2){GetScreenWidth(), GetScreenHeight()}, camera).x;
+
+    window.load0 = window.view0 - (STREAM_LOAD_MARGIN_TILES + (direction < 0 ? STREAM_PREFETCH_TILES : 0)) * tileW;
+    window.load1 = window.view1 + (STREAM_LOAD_MARGIN_TILES + (direction > 0 ? STREAM_PREFETCH_TILES : 0)) * tileW;
+
+    // Prefetched chunks stay until they are this far behind, even after turning around
+    window.keep0 = fminf(window.view0 - STREAM_KEEP_MARGIN_TILES * tileW, window.load0);
+    window.keep1 = fmaxf(window.view1 + STREAM_KEEP_MARGIN_TILES * tileW, window.load1);
+    return window;
+}
+
+void InitWorldStreamer(WorldStreamer *streamer, Camera2D camera) {
+    streamer->lastCameraX = camera.target.x;
+    streamer->direction = 0;
+}
+
+void UpdateWorldStreamer(WorldStreamer *streamer, Level *level, MapRenderCache *cache, Camera2D camera) {
+    // Direction of travel (small jitter doesn't flip it)
+    float moved = camera.target.x - streamer->lastCameraX;
+    if (moved > 0.5f) streamer->direction = 1;
+    else if (moved < -0.5f) streamer->direction = -1;
+    streamer->lastCameraX = camera.target.x;
+
+    StreamWindow window = GetStreamWindow(level, camera, streamer->direction);
+
+    // Gid chunks: grow the resident run to cover the load span, trim it to the keep span
+    float chunkW = (float)LEVEL_CHUNK_TILES * level->header->tileWidth;
+    int load0 = (int)floorf(window.load0 / chunkW), load1 = (int)floorf(window.load1 / chunkW);
+    int keep0 = (int)floorf(window.keep0 / chunkW), keep1 = (int)floorf(window.keep1 / chunkW);
+    int first = level->residentFirst, last = level->residentLast;
+    if (last < first || last < keep0 || first > keep1) {
+        // Nothing useful resident (first update, or the camera jumped)
+        first = load0;
+        last = load1;
+    } else {
+        if (load0 < first) first = load0;
+        if (load1 > last) last = load1;
+        if (first < keep0) first = keep0;
+        if (last > keep1) last = keep1;
+    }
+    SetLevelResidentChunks(level, first, last);
+
+    // Baked textures follow the same window
+    StreamMapRenderCache(cache, level, camera, window, STREAM_BAKES_PER_FRAME, true);
+}
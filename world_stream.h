@@ -0,0 +1,44 @@
+#ifndef WORLD_STREAM_H
+#define WORLD_STREAM_H
+
+// Include necessary libraries
+#include "raylib.h"  // Camera2D
+#include "level.h"   // Level whose chunks are streamed
+
+/*
+    World streaming
+    Only the part of the level around the camera is kept: gid chunks in memory and baked
+    chunk / background textures on the GPU. Both follow the same window:
+        -inside the load span things are brought in
+        -outside the keep span they may be dropped
+        -in between nothing changes, so walking back and forth over a chunk edge doesn't thrash
+    The load span reaches further ahead in the direction the camera is moving.
+    Levels grow sideways, so the window is a span of columns (every row of them is kept).
+*/
+#define STREAM_LOAD_MARGIN_TILES 16    // Loaded this far past the view on both sides
+#define STREAM_KEEP_MARGIN_TILES 48    // Kept until this far past the view
+#define STREAM_PREFETCH_TILES 48       // Extra load distance ahead of the camera
+#define STREAM_BAKES_PER_FRAME 2       // Prefetch bakes per frame (anything on screen is baked at once)
+
+// Column spans around the camera, in world pixels
+typedef struct StreamWindow {
+    float view0, view1;    // On screen
+    float load0, load1;    // Bring in
+    float keep0, keep1;    // Keep (always contains the load span)
+} StreamWindow;
+
+// Streaming state of a running level
+typedef struct WorldStreamer {
+    float lastCameraX;     // Camera position at the previous update
+    int direction;         // -1 left, 1 right, 0 not moved yet (last real direction is kept while standing)
+} WorldStreamer;
+
+struct MapRenderCache;
+
+// Function declarations - world streaming
+StreamWindow GetStreamWindow(const Level *level, Camera2D camera, int direction); // Spans for a camera
+void InitWorldStreamer(WorldStreamer *streamer, Camera2D camera);                  // Start tracking a camera
+// Move the window to the camera: level chunks and baked textures in / out. Outside BeginMode2D (bakes switch targets)
+void UpdateWorldStreamer(WorldStreamer *streamer, Level *level, struct MapRenderCache *cache, Camera2D camera);
+
+#endif